@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  TraceEvents.h - Event table of the binary trace log.
+//
+//  DESCRIPTION
+//      Every trace event has an id & a printf format of up to three integer
+//  (%ld) arguments. The table is shared by the target (ids) & by the host
+//  decoder (formats), so append new events to the end of the list in order
+//  to keep old dumps decodable.
+//
+//  HOWTOSTART
+//      X(TRC_MY_EVENT, "Something happened: %ld")  <- add to the list.
+//      dbg::Trace(dbg::TRC_MY_EVENT, value);
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#define TRACE_EVENTS(X)                                                       \
+    X(TRC_MARK,         "Mark %ld %ld %ld")                                   \
+    X(TRC_FWD_DCT_TIME, "Forward DCT-%ld conversion time: %ld micros.")       \
+    X(TRC_INV_DCT_TIME, "Inverse DCT-%ld conversion time: %ld micros.")
+
+namespace dbg
+{
+
+#define TRACE_EVENT_ID(id, fmt) id,
+enum TraceEventId
+{
+    TRACE_EVENTS(TRACE_EVENT_ID)
+    TRC_EVENT_COUNT
+};
+#undef TRACE_EVENT_ID
+
+/// @brief printf format of every event, indexed by TraceEventId; shared by
+/// the target & the host decoder.
+#define TRACE_EVENT_FMT(id, fmt) fmt,
+const char *const sTraceFormat[TRC_EVENT_COUNT] = { TRACE_EVENTS(TRACE_EVENT_FMT) };
+#undef TRACE_EVENT_FMT
+
+}
@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  TraceLog.cpp - Low overhead binary trace log.
+//
+//  DESCRIPTION
+//      See TraceLog.h.
+//
+//  HOWTOSTART
+//      -
+//
+//  PLATFORM
+//      Raspberry Pi pico.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+#include "TraceLog.h"
+
+namespace dbg
+{
+
+namespace
+{
+
+/// @brief Single producer/single consumer ring of one core.
+struct TraceRing
+{
+    TraceRecord rec[TRACE_RING_SIZE];
+    volatile uint32_t head;                      /* written by producer. */
+    volatile uint32_t tail;                      /* written by consumer. */
+    volatile uint32_t dropped;                   /* overflow counter. */
+    uint32_t seq;                                /* sequence counter. */
+};
+
+TraceRing sRing[2];
+
+/// @brief Takes the oldest record out of the rings, the other core's first
+/// if it is older.
+/// @return 1 a record is taken; 0 the rings are empty.
+int Pop(TraceRecord *prec)
+{
+    TraceRing *pbest = NULL;
+    uint64_t tmbest(~0ULL);
+    for(int c(0); c < 2; ++c)
+    {
+        TraceRing &r = sRing[c];
+        if(r.tail != r.head)
+        {
+            const TraceRecord &rec = r.rec[r.tail & (TRACE_RING_SIZE - 1)];
+            const uint64_t tm = ((uint64_t)rec.tm_hi << 32) | rec.tm_lo;
+            if(tm < tmbest)
+            {
+                tmbest = tm;
+                pbest = &r;
+            }
+        }
+    }
+
+    if(!pbest)
+    {
+        return 0;
+    }
+
+    __dmb();
+    *prec = pbest->rec[pbest->tail & (TRACE_RING_SIZE - 1)];
+    __dmb();
+    pbest->tail = pbest->tail + 1;
+
+    return 1;
+}
+
+}
+
+void __not_in_flash_func(Trace)(uint16_t id, int32_t a0, int32_t a1, int32_t a2)
+{
+    // Raw timer registers: the latched TIMELR/TIMEHR pair is shared by the
+    // cores & IRQ handlers, a trace in between would spoil the high word.
+    const uint64_t tm = time_us_64();
+    const uint32_t core = get_core_num();
+    TraceRing &r = sRing[core];
+
+    const uint32_t irqs = save_and_disable_interrupts();
+    const uint32_t head = r.head;
+    if(head - r.tail >= TRACE_RING_SIZE)
+    {
+        r.dropped = r.dropped + 1;
+        restore_interrupts(irqs);
+        return;
+    }
+
+    TraceRecord &rec = r.rec[head & (TRACE_RING_SIZE - 1)];
+    rec.tm_lo = (uint32_t)tm;
+    rec.tm_hi = (uint32_t)(tm >> 32);
+    rec.id = id;
+    rec.seq = (uint16_t)((r.seq++ & 0x7FFF) | (core << 15));
+    rec.args[0] = a0;
+    rec.args[1] = a1;
+    rec.args[2] = a2;
+
+    __dmb();
+    r.head = head + 1;
+    restore_interrupts(irqs);
+}
+
+int TraceDrainText(int maxrecs)
+{
+    int count(0);
+    TraceRecord rec;
+    stdio_set_driver_enabled(&stdio_uart, false);
+    while(count < maxrecs && Pop(&rec))
+    {
+        uint64_t tm_us = ((uint64_t)rec.tm_hi << 32) | rec.tm_lo;
+
+        const uint32_t tm_day = (uint32_t)(tm_us / 86400000000ULL);
+        tm_us -= (uint64_t)tm_day * 86400000000ULL;
+
+        const uint32_t tm_hour = (uint32_t)(tm_us / 3600000000ULL);
+        tm_us -= (uint64_t)tm_hour * 3600000000ULL;
+
+        const uint32_t tm_min = (uint32_t)(tm_us / 60000000ULL);
+        tm_us -= (uint64_t)tm_min * 60000000ULL;
+
+        const uint32_t tm_sec = (uint32_t)(tm_us / 1000000ULL);
+        tm_us -= (uint64_t)tm_sec * 1000000ULL;
+
+        printf("%02lud%02lu:%02lu:%02lu.%06llu [%04u] ", tm_day, tm_hour, tm_min,
+               tm_sec, tm_us, rec.seq & 0x7FFF);
+        if(rec.id < TRC_EVENT_COUNT)
+        {
+            printf(sTraceFormat[rec.id], rec.args[0], rec.args[1], rec.args[2]);
+        }
+        else
+        {
+            printf("Unknown event %u: %ld %ld %ld", rec.id, rec.args[0],
+                   rec.args[1], rec.args[2]);
+        }
+        printf("\n");
+
+        ++count;
+    }
+    stdio_set_driver_enabled(&stdio_uart, true);
+
+    return count;
+}
+
+int TraceDrainBinary(int maxrecs)
+{
+    int count(0);
+    TraceRecord rec;
+    while(count < maxrecs && Pop(&rec))
+    {
+        putchar_raw(TRACE_SYNC0);
+        putchar_raw(TRACE_SYNC1);
+
+        const uint8_t *p = (const uint8_t *)&rec;
+        for(size_t i(0); i < sizeof(rec); ++i)
+        {
+            putchar_raw(p[i]);
+        }
+
+        ++count;
+    }
+
+    return count;
+}
+
+uint32_t TraceDropped(void)
+{
+    return sRing[0].dropped + sRing[1].dropped;
+}
+
+}
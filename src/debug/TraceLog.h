@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  TraceLog.h - Low overhead binary trace log.
+//
+//  DESCRIPTION
+//      A replacement of StampPrintf() for hot loops. Trace() stores a fixed
+//  size binary record (time stamp, event id, three integer args) into a ring
+//  buffer & returns; no division, no formatting & no I/O is done. Each core
+//  has its own single producer/single consumer ring, so there are no locks:
+//  the producer masks interrupts of its own core for a few instructions only
+//  while it reserves a slot. A record that does not fit is counted & dropped.
+//      The rings are drained in the idle time either as text (the same
+//  time stamped format as of StampPrintf) or as binary records which are
+//  decoded on the host by tools/tracedec.cpp into the very same text.
+//      Binary stream: every record is preceded by two sync bytes 0xA5 0x5A.
+//
+//  HOWTOSTART
+//      dbg::Trace(dbg::TRC_FWD_DCT_TIME, len, tm);    // in the hot loop.
+//      ...
+//      dbg::TraceDrainText(16);                        // when idle.
+//
+//  PLATFORM
+//      Raspberry Pi pico; the record layout & event table are portable.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stdint.h>
+
+#include "TraceEvents.h"
+
+#define TRACE_RING_SIZE 128         /* Records per core, power of two. */
+#define TRACE_SYNC0 0xA5                  /* Sync bytes of binary stream. */
+#define TRACE_SYNC1 0x5A
+
+namespace dbg
+{
+
+/// @brief Binary trace record, 24 bytes, little endian.
+struct TraceRecord
+{
+    uint32_t tm_lo;                     /* time since boot, us; low word. */
+    uint32_t tm_hi;                                        /* high word. */
+    uint16_t id;                                     /* TraceEventId. */
+    uint16_t seq;                 /* sequence number, low 16 bits; the */
+                                        /* core number is in bit 15. */
+    int32_t args[3];                                 /* event arguments. */
+};
+
+void Trace(uint16_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0);
+
+/// @brief Prints up to `maxrecs` records as time stamped text lines.
+/// @return Number of records printed.
+int TraceDrainText(int maxrecs);
+
+/// @brief Writes up to `maxrecs` records to stdio in binary form.
+/// @return Number of records written.
+int TraceDrainBinary(int maxrecs);
+
+/// @brief Number of records dropped because of ring overflow.
+uint32_t TraceDropped(void);
+
+}
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  DCTPeaks.h - Top-K spectral peak detector fused with PicoDCT output pass.
+//
+//  DESCRIPTION
+//      A sink for PicoDCT::FwdFDCT(n, sink). It receives coefficients while
+//  the final recombination pass of the transform produces them, takes their
+//  magnitudes, detects local maxima above the noise threshold & keeps K the
+//  strongest of them sorted by magnitude. The frequency of every peak is
+//  refined by parabolic interpolation over its neighbours. Integer arithmetic
+//  only: one 32-bit division per detected local maximum; no extra pass over
+//  the spectrum & no allocations.
+//
+//  HOWTOSTART
+//      sigproc::PeakDetector<8> peaks(noise_level);
+//      pdct.FwdFDCT(n2, peaks);
+//      for(int i(0); i < peaks.Count(); ++i)
+//          ... peaks[i].bin_q8 / 256.f, peaks[i].mag ...
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stdint.h>
+
+namespace sigproc
+{
+
+/// @brief Spectral peak.
+struct DCTPeak
+{
+    int32_t bin_q8;                  /* refined bin index, scaled by 2^8. */
+    int32_t mag;                             /* magnitude of peak's bin. */
+};
+
+template<int KMAX>
+class PeakDetector final
+{
+public:
+    /// @param threshold Local maxima of magnitude <= threshold are ignored.
+    PeakDetector(int32_t threshold = 0)
+    : _threshold(threshold)
+    , _count(0)
+    , _len(0)
+    , _m1(0)
+    , _m2(0)
+    {
+        static_assert(KMAX > 0, "KMAX must be positive");
+    }
+
+    void SetThreshold(int32_t threshold)
+    {
+        _threshold = threshold;
+    }
+
+    /// @brief Number of peaks found in the last frame, [0...KMAX].
+    int Count() const
+    {
+        return _count;
+    }
+
+    /// @brief Peaks sorted by magnitude, the strongest is the first one.
+    const DCTPeak &operator[](int i) const
+    {
+        return _peaks[i];
+    }
+
+    void Begin(int n)
+    {
+        _count = 0;
+        _len = 1 << n;
+        _m1 = _m2 = 0;
+    }
+
+    /// @brief Accepts coefficient k; checks whether bin k-1 is a peak.
+    inline void operator()(int k, int32_t v)
+    {
+        const int32_t m = v < 0 ? -v : v;
+
+        if(_m1 > _threshold && _m1 >= _m2 && _m1 > m && k)
+        {
+            Candidate(k - 1, m);
+        }
+
+        _m2 = _m1;
+        _m1 = m;
+    }
+
+    void End()
+    {
+        if(_m1 > _threshold && _m1 >= _m2)
+        {
+            Candidate(_len - 1, 0);
+        }
+    }
+
+private:
+
+    /// @brief Refines the peak at bin k & inserts it into the sorted list.
+    /// @param mr Magnitude of the right neighbour; _m1, _m2 are the peak
+    /// & its left neighbour.
+    inline void Candidate(int k, int32_t mr)
+    {
+        if(_count == KMAX && _m1 <= _peaks[KMAX - 1].mag)
+        {
+            return;
+        }
+
+        // Parabolic interpolation: d = (ml - mr) / (2 * (ml - 2 * mc + mr)),
+        // |d| <= 1/2 since mc is the maximum. Scale the terms down in order
+        // to keep 128 * num in 32 bits.
+        int32_t num = _m2 - mr;
+        int32_t den = _m2 - (_m1 << 1) + mr;
+        while(num > (1L << 23) || num < -(1L << 23))
+        {
+            num >>= 1;
+            den >>= 1;
+        }
+
+        int32_t d_q8 = den ? (num * 128) / den : 0;
+        if(d_q8 > 128)
+        {
+            d_q8 = 128;
+        }
+        else if(d_q8 < -128)
+        {
+            d_q8 = -128;
+        }
+
+        int i = _count < KMAX ? _count++ : KMAX - 1;
+        for(; i > 0 && _peaks[i - 1].mag < _m1; --i)
+        {
+            _peaks[i] = _peaks[i - 1];
+        }
+
+        _peaks[i].bin_q8 = (k << 8) + d_q8;
+        _peaks[i].mag = _m1;
+    }
+
+    int32_t _threshold;                           /* noise threshold. */
+    int _count;                                /* number of peaks found. */
+    int _len;                                 /* length of current frame. */
+    int32_t _m1;                            /* magnitude of previous bin. */
+    int32_t _m2;                     /* magnitude of bin before previous. */
+    DCTPeak _peaks[KMAX];                       /* peaks sorted by mag. */
+};
+
+}
@@ -0,0 +1,322 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  DCTScheduler.h - Deadline-aware frame processing with graceful degradation.
+//
+//  DESCRIPTION
+//      Runs forward FDCT, user processing & inverse FDCT of a frame within a
+//  per-frame time budget. In a real-time loop a late frame is worse than a
+//  slightly less accurate one, so when the frames get too expensive (another
+//  core is busy, IRQ load, heavy processing) the scheduler switches to cheaper
+//  variants, every level being about half the cost of the previous one:
+//          level 0          full size transforms, 2^n;
+//          level 1..S       2^(n-l) transforms of the input summed in groups
+//                           of 2^l samples. The sum is a boxcar, not a real
+//                           low-pass: the kept bins have the same spacing &
+//                           scale as at level 0 but are attenuated near the
+//                           top (-3.7 dB at the new Nyquist for l = 2) & the
+//                           content above it aliases into them. The output
+//                           is held for 2^l samples, which droops the top
+//                           band once more;
+//          level S+1        as level S, the inverse is skipped (optional).
+//  Each frame is timed with DCTClockMicros() (utl::GetUptime64() on Pico, a
+//  monotonic clock on the host). A frame over the budget or a smoothed cost
+//  close to it moves one level down at once. The way back is cautious: after
+//  a number of calm frames at which twice the current cost fits into 3/4 of
+//  the budget, one level up is tried. The budget should be at least tens of
+//  microseconds, the resolution of the clock.
+//      The statistics of missed deadlines & degradation are collected.
+//
+//  HOWTOSTART
+//      sigproc::PicoDCT pdct(10);
+//      sigproc::DCTScheduler sched(pdct, 10, 2000);    // 2 ms per frame.
+//      for(;;)
+//      {
+//          ... get 1024 samples into pin ...
+//          sched.Frame(pin, pout, proc);  // proc(pcoeffs, n): trim, scale...
+//          ... pout[] unless the frame level skipped the inverse ...
+//      }
+//      See tools/dctsched.cpp for a host simulation.
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//      Rev 0.2   18 Oct 2026   SetLevel(); degraded levels' response documented.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "PicoDCT.h"
+
+#define DCT_SCHED_MAXSHIFT 4            /* Max. size reduction, 2^s times. */
+#define DCT_SCHED_CALM 16           /* Calm frames before a level up try. */
+
+namespace sigproc
+{
+
+struct DCTSchedStats
+{
+    uint32_t frames;                                 /* frames processed. */
+    uint32_t missed;                         /* frames over the budget. */
+    uint32_t degraded;                        /* frames below level 0. */
+    uint32_t skipped_inv;                /* frames without the inverse. */
+    uint32_t downgrades;                   /* switches to a cheaper level. */
+    uint32_t upgrades;                       /* switches to a better level. */
+    uint32_t last_us;                             /* cost of last frame. */
+    uint32_t worst_us;                           /* cost of worst frame. */
+    uint32_t level_frames[DCT_SCHED_MAXSHIFT + 2];     /* frames per level. */
+};
+
+class DCTScheduler final
+{
+public:
+    /// @param dct Transform engine, its n2max must be >= n2.
+    /// @param n2 Frame length, 2^n2 samples; [2...12].
+    /// @param budget_us Time budget of a frame, microseconds.
+    /// @param maxshift Max. size reduction, the smallest size is 2^(n2-s).
+    /// @param skipinv Whether the last level skips the inverse transform.
+    DCTScheduler(PicoDCT &dct, int n2, uint32_t budget_us, int maxshift = 2,
+                 bool skipinv = true)
+    : _dct(dct)
+    , _n2(n2)
+    , _maxshift(maxshift)
+    , _maxlevel(skipinv ? maxshift + 1 : maxshift)
+    , _budget(budget_us)
+    , _level(0)
+    , _calm(0)
+    , _est(0)
+    {
+        ASSERT_(n2 >= 2 && n2 < 13);
+        ASSERT_(maxshift >= 0 && maxshift <= DCT_SCHED_MAXSHIFT);
+        ASSERT_(n2 - maxshift >= 2);
+
+        ResetStats();
+    }
+
+    DCTScheduler(const DCTScheduler &) = delete;
+    DCTScheduler &operator=(const DCTScheduler &) = delete;
+
+    void SetBudget(uint32_t budget_us)
+    {
+        _budget = budget_us;
+    }
+
+    uint32_t GetBudget() const
+    {
+        return _budget;
+    }
+
+    /// @brief Level the next frame will be processed at.
+    int GetLevel() const
+    {
+        return _level;
+    }
+
+    /// @brief Forces the level of the next frame, e.g. ahead of a known busy
+    /// period; the control goes on from it.
+    void SetLevel(int level)
+    {
+        ASSERT_(level >= 0 && level <= _maxlevel);
+
+        _level = level;
+        _calm = 0;
+    }
+
+    int MaxLevel() const
+    {
+        return _maxlevel;
+    }
+
+    /// @brief Transform size of a level, 2^n.
+    int LevelN2(int level) const
+    {
+        return _n2 - (level < _maxshift ? level : _maxshift);
+    }
+
+    /// @brief Whether a level skips the inverse transform.
+    bool LevelSkipsInverse(int level) const
+    {
+        return level > _maxshift;
+    }
+
+    const DCTSchedStats &GetStats() const
+    {
+        return _stats;
+    }
+
+    void ResetStats()
+    {
+        memset(&_stats, 0, sizeof(_stats));
+    }
+
+    /// @brief Processes a frame at the current level & picks the level of
+    /// the next one.
+    /// @param pin Input, 2^n2 samples of up to PicoDCT::InputBits(n2) bits;
+    /// then the sums of the degraded levels fit the shorter transforms too.
+    /// @param pout Output, 2^n2 samples; NULL if no inverse is needed. It is
+    /// not touched at the levels which skip the inverse.
+    /// @param proc Processing of coefficients, called as proc(pcoeffs, n)
+    /// between the transforms, n being the size of the level. The scaling
+    /// of coefficients before the inverse (see PicoDCT.h) is up to it.
+    /// @return >= 0 level the frame is processed at; -1 transform error.
+    template<class TProc>
+    int Frame(const int32_t *pin, int32_t *pout, TProc &proc)
+    {
+        const int level(_level);
+        const int shift(_n2 - LevelN2(level));
+        const int n(_n2 - shift);
+        const int len(1 << n);
+        const bool inverse = pout && !LevelSkipsInverse(level);
+
+        const uint64_t tm_start = DCTClockMicros();
+
+        int32_t *pbuf = _dct.SetBuf();
+        if(!shift)
+        {
+            memcpy(pbuf, pin, len * sizeof(int32_t));
+        }
+        else
+        {
+            // Sums keep the scale of the bins: 2^l gain of the input makes
+            // up for 2^l smaller gain of the shorter inverse, so the output
+            // comes at the scale of level 0 as it is. No anti-alias filter
+            // here, it would cost more than the level saves.
+            for(int i(0); i < len; ++i)
+            {
+                int32_t sum(0);
+                for(int j(i << shift); j < (i + 1) << shift; ++j)
+                {
+                    sum += pin[j];
+                }
+                pbuf[i] = sum;
+            }
+        }
+
+        if(_dct.FwdFDCT(n))
+        {
+            return -1;
+        }
+
+        proc(pbuf, n);
+
+        if(inverse)
+        {
+            if(_dct.InvFDCT(n))
+            {
+                return -1;
+            }
+
+            if(!shift)
+            {
+                memcpy(pout, pbuf, len * sizeof(int32_t));
+            }
+            else
+            {
+                for(int i(0); i < len; ++i)
+                {
+                    const int32_t val = pbuf[i];
+                    for(int j(i << shift); j < (i + 1) << shift; ++j)
+                    {
+                        pout[j] = val;
+                    }
+                }
+            }
+        }
+
+        const uint32_t dt = (uint32_t)(DCTClockMicros() - tm_start);
+
+        ++_stats.frames;
+        ++_stats.level_frames[level];
+        _stats.degraded += level > 0;
+        _stats.skipped_inv += pout && !inverse;
+        _stats.last_us = dt;
+        _stats.worst_us = dt > _stats.worst_us ? dt : _stats.worst_us;
+
+        Control(dt);
+
+        return level;
+    }
+
+private:
+
+    /// @brief Updates the smoothed cost & moves the level if necessary.
+    void Control(uint32_t dt)
+    {
+        const bool missed = dt > _budget;
+        _stats.missed += missed;
+
+        _est = _est ? _est + (((int32_t)dt - (int32_t)_est) >> 2) : dt;
+
+        if((missed || _est > _budget - (_budget >> 4)) && _level < _maxlevel)
+        {
+            ++_level;
+            ++_stats.downgrades;
+            _est >>= 1;
+            _calm = 0;
+
+            return;
+        }
+
+        if(_level > 0 && (_est << 1) <= _budget - (_budget >> 2))
+        {
+            if(++_calm >= DCT_SCHED_CALM)
+            {
+                --_level;
+                ++_stats.upgrades;
+                _est <<= 1;
+                _calm = 0;
+            }
+
+            return;
+        }
+
+        _calm = 0;
+    }
+
+    PicoDCT &_dct;                                   /* transform engine. */
+    const int _n2;                           /* full frame length, 2^n. */
+    const int _maxshift;                      /* max. size reduction, 2^s. */
+    const int _maxlevel;                             /* the cheapest level. */
+    uint32_t _budget;                            /* frame budget, us. */
+    int _level;                                 /* level of next frame. */
+    int _calm;                         /* calm frames at current level. */
+    uint32_t _est;                     /* smoothed cost at current level. */
+    DCTSchedStats _stats;                             /* frame statistics. */
+};
+
+}
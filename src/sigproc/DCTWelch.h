@@ -0,0 +1,318 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  DCTWelch.h - Averaged power spectrum & waterfall accumulator for PicoDCT.
+//
+//  DESCRIPTION
+//      Welch-style averaging of DCT power spectra. The accumulator is a sink
+//  for PicoDCT::FwdFDCT(n, sink): squared coefficients are integrated while
+//  the last pass of the transform produces them, so there is no extra loop
+//  over the spectrum. Adjacent bins are summed in groups of 2^d (decimation)
+//  & the result is averaged over 2^m frames either linearly (plain mean, the
+//  accumulator restarts every row) or exponentially (acc += (p - acc) / 2^m,
+//  a row is sampled every 2^m frames). Every 2^m frames a row of 2^(n - d)
+//  values is emitted, ready for a waterfall display or for logging.
+//      All the arithmetic is 32-bit: a coefficient is shifted right by the
+//  power shift & saturated to 16 bits before squaring, the partial sums are
+//  prescaled so that they can't overflow.
+//      Feed() is a helper which cuts a sample stream into overlapped Hann
+//  windowed frames with the given hop & runs the fused transform for each.
+//  The input is 12-bit signed. The headroom of PicoDCT shrinks with the size
+//  (see PicoDCT::InputBits()), so the windowed samples are shifted right by
+//  InShift() bits, set at init; the coefficients, hence the power shift, are
+//  at the scale of input * 2^(-InShift()).
+//
+//  HOWTOSTART
+//      sigproc::PicoDCT pdct(10);
+//      sigproc::WelchAccumulator welch(10, 512, 2, 4);  // 50% overlap, 256
+//      for(;;)                                          // bins, 16 frames.
+//      {
+//          welch.Feed(pdct, psamples, count);         // 12-bit signed.
+//          if(welch.GetRow(prow)) ... prow[0...welch.RowSize()-1] ...
+//      }
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//      Rev 0.2   18 Oct 2026   Input scaled to the headroom of PicoDCT.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "PicoDCT.h"
+
+namespace sigproc
+{
+
+enum WelchMode
+{
+    WELCH_LINEAR,                                /* mean over 2^m frames. */
+    WELCH_EXPONENTIAL                     /* exponential, alpha = 2^(-m). */
+};
+
+class WelchAccumulator final
+{
+public:
+    /// @param n2 Length of transform, 2^n2 values; [2...12].
+    /// @param hop Input samples between frames for Feed(); [1...2^n2].
+    /// @param log2decim Bins per output bin, 2^log2decim; [0...n2].
+    /// @param log2frames Frames per row & averaging constant, 2^log2frames.
+    /// @param mode Linear or exponential averaging.
+    /// @param pwrshift Right shift of coefficients before squaring.
+    WelchAccumulator(int n2, int hop, int log2decim, int log2frames,
+                     WelchMode mode = WELCH_LINEAR, int pwrshift = 4)
+    : _n2(n2)
+    , _hop(hop)
+    , _log2decim(log2decim)
+    , _log2frames(log2frames)
+    , _mode(mode)
+    , _pwrshift(pwrshift)
+    , _inshift(0)
+    , _fill(0)
+    , _frame(0)
+    , _rowready(false)
+    , _psum(0)
+    , _pwnd(NULL)
+    , _phist(NULL)
+    , _pacc(NULL)
+    , _prow(NULL)
+    {
+        ASSERT_(n2 >= 2 && n2 < 13);
+        ASSERT_(hop > 0 && hop <= (1 << n2));
+        ASSERT_(log2decim >= 0 && log2decim <= n2);
+        ASSERT_(log2frames >= 0 && log2frames < 16);
+
+        Init();
+    }
+
+    WelchAccumulator(const WelchAccumulator &) = delete;
+    WelchAccumulator &operator=(const WelchAccumulator &) = delete;
+
+    ~WelchAccumulator()
+    {
+        free(_pwnd);
+        free(_phist);
+        free(_pacc);
+        free(_prow);
+    }
+
+    /// @brief Number of values in a row, 2^(n2 - log2decim).
+    int RowSize() const
+    {
+        return 1 << (_n2 - _log2decim);
+    }
+
+    /// @brief Right shift of windowed samples which keeps 12-bit input within
+    /// the headroom of PicoDCT at this size.
+    int InShift() const
+    {
+        return _inshift;
+    }
+
+    /// @brief Copies the latest row if a new one is emitted since last call.
+    /// @param pdst Output of RowSize() values.
+    /// @return 1 a row is copied; 0 no new row.
+    int GetRow(uint32_t *pdst)
+    {
+        if(!_rowready)
+        {
+            return 0;
+        }
+
+        memcpy(pdst, _prow, RowSize() * sizeof(uint32_t));
+        _rowready = false;
+
+        return 1;
+    }
+
+    /// @brief Cuts samples into overlapped windowed frames & accumulates
+    /// their power spectra.
+    /// @param pdct Transform engine, its n2max must be >= n2.
+    /// @param pin Input samples, 12-bit signed.
+    /// @param count Number of input samples.
+    /// @return Number of frames processed.
+    int Feed(PicoDCT &pdct, const int32_t *pin, int count)
+    {
+        const int len(1 << _n2);
+        int frames(0);
+        while(count > 0)
+        {
+            const int chunk = min_(count, len - _fill);
+            memcpy(_phist + _fill, pin, chunk * sizeof(int32_t));
+            _fill += chunk;
+            pin += chunk;
+            count -= chunk;
+
+            if(_fill < len)
+            {
+                break;
+            }
+
+            int32_t *pbuf = pdct.SetBuf();
+            for(int i(0); i < len; ++i)
+            {
+                pbuf[i] = (_phist[i] * _pwnd[i]) >> (15 + _inshift);
+            }
+
+            if(pdct.FwdFDCT(_n2, *this))
+            {
+                break;
+            }
+            ++frames;
+
+            memmove(_phist, _phist + _hop, (len - _hop) * sizeof(int32_t));
+            _fill = len - _hop;
+        }
+
+        return frames;
+    }
+
+    void Begin(int n)
+    {
+        ASSERT_(n == _n2);
+        _psum = 0;
+    }
+
+    /// @brief Accumulates power of coefficient k.
+    inline void operator()(int k, int32_t v)
+    {
+        uint32_t a = (uint32_t)(v < 0 ? -v : v) >> _pwrshift;
+        a = a > 0xFFFFU ? 0xFFFFU : a;
+
+        _psum += (a * a) >> _log2decim;
+
+        const uint32_t dmask = (1U << _log2decim) - 1;
+        if((k & dmask) != dmask)
+        {
+            return;
+        }
+
+        uint32_t &acc = _pacc[k >> _log2decim];
+        if(_mode == WELCH_LINEAR)
+        {
+            acc += _psum >> _log2frames;
+        }
+        else if(_psum >= acc)
+        {
+            acc += (_psum - acc) >> _log2frames;
+        }
+        else
+        {
+            acc -= (acc - _psum) >> _log2frames;
+        }
+
+        _psum = 0;
+    }
+
+    void End()
+    {
+        if(++_frame < (1 << _log2frames))
+        {
+            return;
+        }
+
+        _frame = 0;
+        memcpy(_prow, _pacc, RowSize() * sizeof(uint32_t));
+        _rowready = true;
+
+        if(_mode == WELCH_LINEAR)
+        {
+            memset(_pacc, 0, RowSize() * sizeof(uint32_t));
+        }
+    }
+
+private:
+
+    static inline int min_(int a, int b)
+    {
+        return a < b ? a : b;
+    }
+
+    /// @brief Provides memory allocation, calculates Hann window & the input
+    /// shift.
+    void Init()
+    {
+        const int len(1 << _n2);
+
+        _pwnd = (int16_t *)malloc(len * sizeof(int16_t));
+        ASSERT_(_pwnd);
+
+        _phist = (int32_t *)malloc(len * sizeof(int32_t));
+        ASSERT_(_phist);
+
+        _pacc = (uint32_t *)calloc(RowSize(), sizeof(uint32_t));
+        ASSERT_(_pacc);
+
+        _prow = (uint32_t *)calloc(RowSize(), sizeof(uint32_t));
+        ASSERT_(_prow);
+
+        for(int i(0); i < len; ++i)
+        {
+            const double dwnd = .5 - .5 * cos(2. * M_PI * ((double)i + .5) / (double)len);
+            _pwnd[i] = (int16_t)floor(32767. * dwnd + .5);
+        }
+
+        // The peak of a windowed 12-bit sample must stay below the DCT input
+        // limit of 2^(InputBits(n2) - 1).
+        const int limbits = PicoDCT::InputBits(_n2) - 1;
+        while(((2048LL * 32767) >> (15 + _inshift)) + 1 >= (1LL << limbits))
+        {
+            ++_inshift;
+        }
+    }
+
+    const int _n2;                              /* transform size, 2^n2. */
+    const int _hop;                          /* samples between frames. */
+    const int _log2decim;                   /* bins per output bin, 2^d. */
+    const int _log2frames;                 /* frames per row, 2^m. */
+    const WelchMode _mode;                          /* averaging mode. */
+    const int _pwrshift;               /* coefficient shift before x^2. */
+    int _inshift;                      /* windowed sample scale shift. */
+    int _fill;                           /* samples in history buffer. */
+    int _frame;                              /* frame number in a row. */
+    bool _rowready;                        /* new row is not taken yet. */
+    uint32_t _psum;                     /* power of current bin group. */
+    int16_t *_pwnd;                                /* Hann window, Q15. */
+    int32_t *_phist;                          /* input sample history. */
+    uint32_t *_pacc;                           /* power accumulators. */
+    uint32_t *_prow;                              /* latest full row. */
+};
+
+}
@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  DCTWisdom.h - Persistent store of PicoDCT tuned plans ("wisdom").
+//
+//  DESCRIPTION
+//      PicoDCT can run a transform of a given size in several bit-exact ways
+//  (now: the depth at which the recursion is cut by an unrolled codelet). The
+//  fastest way depends on the size & on the machine, so PicoDCT measures the
+//  candidates on the first construction for every size which has no plan yet
+//  & stores the winner here. The store is process-wide; it can be exported to
+//  a small blob (kept in flash or in a file) & imported at the next start, so
+//  the tuning is paid only once.
+//      On the host the store is guarded by a mutex, so PicoDCTs may be
+//  constructed from several threads; still, tune (or import) the sizes
+//  before starting the threads, since concurrent tuning measures wrong
+//  timings & may tune a size twice. On Pico there is no lock: construct the
+//  PicoDCTs of both cores one after another (e.g. before launching core 1)
+//  or import the wisdom & SetAutoTune(false) first.
+//      Blob layout:
+//          uint8_t  'D', 'W', version, platform, count
+//          uint8_t  entry[count][3]        n, forward leaf, inverse leaf
+//          uint8_t  checksum               sum of all the previous bytes
+//
+//  HOWTOSTART
+//      sigproc::DCTWisdom::Instance().Import(pblob, blobsize);   // at start.
+//      sigproc::PicoDCT pdct(10);                // tunes missing sizes only.
+//      const int sz = sigproc::DCTWisdom::Instance().Export(pblob, maxsize);
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//      Rev 0.2   18 Oct 2026   Mutex-guarded store on the host.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stdint.h>
+
+#ifdef PICO_DEFAULT_IRQ_PRIORITY
+#include <utility.h>
+#define DCT_WISDOM_PLATFORM 1                      /* Raspberry Pi Pico. */
+#else
+#include <chrono>
+#include <mutex>
+#define DCT_WISDOM_PLATFORM 2                              /* Host build. */
+#endif
+
+#define DCT_WISDOM_VERSION 1
+#define DCT_WISDOM_MAXN2 12               /* Max. transform size, 2^n. */
+#define DCT_LEAF_MAX 2              /* Largest unrolled codelet, 2^n. */
+
+namespace sigproc
+{
+
+/// @brief Monotonic time, microseconds.
+inline uint64_t DCTClockMicros()
+{
+#ifdef PICO_DEFAULT_IRQ_PRIORITY
+    return utl::GetUptime64();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+class DCTWisdom final
+{
+public:
+    static DCTWisdom &Instance()
+    {
+        static DCTWisdom sWisdom;
+        return sWisdom;
+    }
+
+    /// @brief Retrieves the plan of the transform of size 2^n.
+    /// @return 0 OK; -1 there is no plan for this size.
+    int Get(int n, int *pfwdleaf, int *pinvleaf) const
+    {
+        Guard guard(*this);
+        if(n < 0 || n > DCT_WISDOM_MAXN2 || !_known[n])
+        {
+            return -1;
+        }
+
+        *pfwdleaf = _fwdleaf[n];
+        *pinvleaf = _invleaf[n];
+
+        return 0;
+    }
+
+    void Set(int n, int fwdleaf, int invleaf)
+    {
+        Guard guard(*this);
+        Store(n, fwdleaf, invleaf);
+    }
+
+    /// @brief Drops all the plans; next PicoDCT construction re-tunes.
+    void Forget()
+    {
+        Guard guard(*this);
+        for(int n(0); n <= DCT_WISDOM_MAXN2; ++n)
+        {
+            _known[n] = 0;
+        }
+    }
+
+    /// @brief Whether PicoDCT measures sizes missing in the store (default).
+    void SetAutoTune(bool on)
+    {
+        Guard guard(*this);
+        _autotune = on;
+    }
+
+    bool GetAutoTune() const
+    {
+        Guard guard(*this);
+        return _autotune;
+    }
+
+    /// @brief Max. size of exported blob.
+    static int MaxBlobSize()
+    {
+        return 6 + 3 * (DCT_WISDOM_MAXN2 + 1);
+    }
+
+    /// @brief Writes all the known plans into a blob.
+    /// @return > 0 blob size, bytes; -1 no room in the buffer.
+    int Export(uint8_t *pdst, int dstsize) const
+    {
+        Guard guard(*this);
+        int count(0);
+        for(int n(0); n <= DCT_WISDOM_MAXN2; ++n)
+        {
+            count += _known[n];
+        }
+
+        const int size = 6 + 3 * count;
+        if(dstsize < size)
+        {
+            return -1;
+        }
+
+        pdst[0] = 'D';
+        pdst[1] = 'W';
+        pdst[2] = DCT_WISDOM_VERSION;
+        pdst[3] = DCT_WISDOM_PLATFORM;
+        pdst[4] = (uint8_t)count;
+
+        uint8_t *p = pdst + 5;
+        for(int n(0); n <= DCT_WISDOM_MAXN2; ++n)
+        {
+            if(_known[n])
+            {
+                *p++ = (uint8_t)n;
+                *p++ = _fwdleaf[n];
+                *p++ = _invleaf[n];
+            }
+        }
+
+        *p = Checksum(pdst, size - 1);
+
+        return size;
+    }
+
+    /// @brief Merges plans from a blob into the store.
+    /// @return 0 OK; -1 not a wisdom blob or it is corrupted; -2 the blob is
+    /// of other version or it was made on other platform.
+    int Import(const uint8_t *psrc, int srcsize)
+    {
+        if(srcsize < 6 || psrc[0] != 'D' || psrc[1] != 'W'
+           || srcsize < 6 + 3 * psrc[4]
+           || Checksum(psrc, 5 + 3 * psrc[4]) != psrc[5 + 3 * psrc[4]])
+        {
+            return -1;
+        }
+
+        if(psrc[2] != DCT_WISDOM_VERSION || psrc[3] != DCT_WISDOM_PLATFORM)
+        {
+            return -2;
+        }
+
+        Guard guard(*this);
+        const uint8_t *p = psrc + 5;
+        for(int i(0); i < psrc[4]; ++i, p += 3)
+        {
+            if(p[1] <= DCT_LEAF_MAX && p[2] <= DCT_LEAF_MAX)
+            {
+                Store(p[0], p[1], p[2]);
+            }
+        }
+
+        return 0;
+    }
+
+private:
+
+#ifdef PICO_DEFAULT_IRQ_PRIORITY
+    /// @brief No lock on Pico, see DESCRIPTION.
+    struct Guard
+    {
+        explicit Guard(const DCTWisdom &) {}
+    };
+#else
+    struct Guard
+    {
+        explicit Guard(const DCTWisdom &w) : _lk(w._lock) {}
+        std::lock_guard<std::mutex> _lk;
+    };
+#endif
+
+    DCTWisdom()
+    : _autotune(true)
+    {
+        Forget();
+    }
+
+    DCTWisdom(const DCTWisdom &) = delete;
+    DCTWisdom &operator=(const DCTWisdom &) = delete;
+
+    /// @brief Set() without the lock.
+    void Store(int n, int fwdleaf, int invleaf)
+    {
+        if(n < 0 || n > DCT_WISDOM_MAXN2)
+        {
+            return;
+        }
+
+        _fwdleaf[n] = (uint8_t)fwdleaf;
+        _invleaf[n] = (uint8_t)invleaf;
+        _known[n] = 1;
+    }
+
+    static uint8_t Checksum(const uint8_t *p, int size)
+    {
+        uint8_t sum(0x5A);
+        for(int i(0); i < size; ++i)
+        {
+            sum += p[i];
+        }
+
+        return sum;
+    }
+
+    uint8_t _fwdleaf[DCT_WISDOM_MAXN2 + 1];        /* forward codelet, 2^n. */
+    uint8_t _invleaf[DCT_WISDOM_MAXN2 + 1];        /* inverse codelet, 2^n. */
+    uint8_t _known[DCT_WISDOM_MAXN2 + 1];          /* the size is tuned. */
+    bool _autotune;                   /* measure sizes missing in store. */
+#ifndef PICO_DEFAULT_IRQ_PRIORITY
+    mutable std::mutex _lock;                  /* guards the store, host. */
+#endif
+};
+
+}
@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  PicoCMFB.h - Cosine-modulated filterbank channelizer based on PicoDCT.
+//
+//  DESCRIPTION
+//      Splits a wideband real stream into M = 2^n equally spaced channels,
+//  channel k covers [k, k+1] * Fs / (2M). The analysis filter of channel k is
+//  the lowpass prototype h[] of length L = 2*K*M modulated by
+//      cos(pi/M * (k + 1/2) * (i + 1/2 + M/2)).
+//  All the channels are computed at once per block of D new input samples:
+//      1. Polyphase part: L products of prototype & history are folded into
+//         2M values (the modulation changes its sign every 2M taps).
+//      2. The 2M values are folded into M (MDCT-like TDAC folding).
+//      3. DCT-IV of M values gives the outputs of all channels. It is taken
+//         as the odd bins of PicoDCT's 2M-point DCT-II of zero padded data.
+//  Prototype filter is a 16-bit fixed point table calculated once at init,
+//  the data path is integer only.
+//      The decimation D is configurable in range [1...M]: D = M gives the
+//  critically sampled filterbank, smaller D gives oversampled channels with
+//  less aliasing between them.
+//      The channel outputs are not normalized: a tone in the middle of the
+//  channel appears with the amplitude of about (input * M * 2^(15 - Q)),
+//  where Q = QShift() is the scale shift of polyphase part. It is chosen at
+//  init so that no 12-bit input can overflow the 2M-point DCT (see
+//  PicoDCT::InputBits()); the headroom of PicoDCT shrinks with the size, so
+//  the larger M, the coarser the outputs.
+//
+//  HOWTOSTART
+//      sigproc::PicoCMFB cmfb(5, 4);           // 32 channels, L = 256 taps.
+//      for(;;)
+//      {
+//          ... get cmfb.Decimation() samples into pin[] ...
+//          cmfb.Process(pin, pout);          // pout[k] - channel k sample.
+//      }
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "PicoDCT.h"
+
+namespace sigproc
+{
+
+class PicoCMFB final
+{
+public:
+    /// @param n2ch Number of channels, M = 2^n2ch; [2...11].
+    /// @param overlap Prototype length in 2M blocks, K; 1, 2, 4 or 8.
+    /// @param decim Decimation D, input samples per block; [1...M], 0 is M.
+    PicoCMFB(int n2ch = 5, int overlap = 4, int decim = 0)
+    : _dct(n2ch + 1)
+    , _n2ch(n2ch)
+    , _len(overlap << (n2ch + 1))
+    , _decim(decim ? decim : 1 << n2ch)
+    , _qshift(0)
+    , _pos(0)
+    , _proto(NULL)
+    , _hist(NULL)
+    , _fold(NULL)
+    {
+        ASSERT_(n2ch >= 2 && n2ch < 12);
+        ASSERT_(overlap == 1 || overlap == 2 || overlap == 4 || overlap == 8);
+        ASSERT_(_decim > 0 && _decim <= (1 << n2ch));
+
+        Init();
+    }
+
+    PicoCMFB(const PicoCMFB &) = delete;
+    PicoCMFB &operator=(const PicoCMFB &) = delete;
+
+    ~PicoCMFB()
+    {
+        free(_proto);
+        free(_hist);
+        free(_fold);
+    }
+
+    int Channels() const
+    {
+        return 1 << _n2ch;
+    }
+
+    int Decimation() const
+    {
+        return _decim;
+    }
+
+    /// @brief Scale shift of polyphase part, Q.
+    int QShift() const
+    {
+        return _qshift;
+    }
+
+    /// @brief Pushes a block of input samples & calculates all the channels.
+    /// @param pin Decimation() new input samples, 12-bit signed.
+    /// @param pout Channels() output samples, one per channel.
+    void Process(const int32_t *pin, int32_t *pout)
+    {
+        const int M = 1 << _n2ch;
+        const int M2 = M << 1;
+        const int mask = _len - 1;
+
+        for(int i(0); i < _decim; ++i)
+        {
+            _pos = (_pos + 1) & mask;
+            _hist[_pos] = pin[i];
+        }
+
+        // Polyphase part: y[i] = sum_j (-1)^j h[i + 2Mj] x[t - i - 2Mj].
+        for(int i(0); i < M2; ++i)
+        {
+            int32_t acc(0);
+            int sign(1);
+            for(int j(i); j < _len; j += M2, sign = -sign)
+            {
+                const int32_t prod = _proto[j] * _hist[(_pos - j) & mask];
+                acc += sign > 0 ? prod : -prod;
+            }
+            _fold[i] = acc >> _qshift;
+        }
+
+        // TDAC folding of quarters (a, b, c, d) into (-c_r - d, a - b_r).
+        const int H = M >> 1;
+        int32_t *pbuf = _dct.SetBuf();
+        for(int i(0); i < H; ++i)
+        {
+            pbuf[i] = -_fold[3 * H - 1 - i] - _fold[3 * H + i];
+            pbuf[H + i] = _fold[i] - _fold[M - 1 - i];
+        }
+
+        // DCT-IV of M values is the odd half of 2M-point DCT-II of the same
+        // values padded with zeros. Twice as long transform, but no error
+        // accumulating DCT-II -> DCT-IV recurrence.
+        for(int i(M); i < M2; ++i)
+        {
+            pbuf[i] = 0;
+        }
+
+        _dct.FwdFDCT(_n2ch + 1);
+
+        const int32_t *pw = _dct.GetBuf();
+        for(int k(0); k < M; ++k)
+        {
+            pout[k] = pw[(k << 1) + 1];
+        }
+    }
+
+private:
+
+    /// @brief Provides memory allocation & calculates prototype filter.
+    void Init()
+    {
+        const int M = 1 << _n2ch;
+
+        _proto = (int16_t *)malloc(_len * sizeof(int16_t));
+        ASSERT_(_proto);
+
+        _hist = (int32_t *)calloc(_len, sizeof(int32_t));
+        ASSERT_(_hist);
+
+        _fold = (int32_t *)malloc(2 * M * sizeof(int32_t));
+        ASSERT_(_fold);
+
+        // Blackman windowed sinc, cutoff pi/2M, scaled to the 16-bit peak.
+        const double dmid = .5 * (double)(_len - 1);
+        for(int i(0); i < _len; ++i)
+        {
+            const double dt = ((double)i - dmid) / (double)(2 * M);
+            const double dsinc = fabs(dt) > 1e-12 ? sin(M_PI * dt) / (M_PI * dt) : 1.;
+            const double dphi = 2. * M_PI * ((double)i + .5) / (double)_len;
+            const double dwnd = .42 - .5 * cos(dphi) + .08 * cos(2. * dphi);
+
+            _proto[i] = (int16_t)floor(32767. * dsinc * dwnd + .5);
+        }
+
+        // Worst case of a folded value is 2 * max_i(sum_j |h[i + 2Mj]|) * 2^11
+        // (two polyphase outputs of 12-bit input), it must stay below the
+        // DCT input limit of 2^(InputBits(n + 1) - 1).
+        int32_t hsum(0);
+        for(int i(0); i < 2 * M; ++i)
+        {
+            int32_t sum(0);
+            for(int j(i); j < _len; j += 2 * M)
+            {
+                sum += _proto[j] < 0 ? -_proto[j] : _proto[j];
+            }
+            hsum = sum > hsum ? sum : hsum;
+        }
+
+        const int limbits = PicoDCT::InputBits(_n2ch + 1) - 1;
+        while((((int64_t)hsum << 12) >> _qshift) + 2 >= (1LL << limbits))
+        {
+            ++_qshift;
+        }
+    }
+
+    PicoDCT _dct;                                  /* 2M-point DCT engine. */
+    const int _n2ch;                             /* number of channels, 2^n. */
+    const int _len;                          /* prototype length, 2*K*M. */
+    const int _decim;                     /* input samples per block, D. */
+    int _qshift;                      /* polyphase output scale shift. */
+    int _pos;                                /* newest sample in history. */
+    int16_t *_proto;                         /* prototype filter, Q15. */
+    int32_t *_hist;                           /* circular input history. */
+    int32_t *_fold;                        /* polyphase output, 2M values. */
+};
+
+}
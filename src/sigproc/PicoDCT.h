@@ -27,12 +27,27 @@
 //      3. Process the data in any way you need (trim coeffs etc).
 //      4. Divide every data value to 8 (or apply right shift by 3 bits).
 //      5. Do reverse transform of data if your project requires so.
+//      In order to avoid heap usage, declare `static PicoDCTArena<n2max>` &
+//  construct the object as PicoDCT(n2max, arena.buf).
+//      The constructor measures the variants of every transform size that
+//  has no plan in DCTWisdom yet (a fraction of a second on Pico). Import the
+//  saved wisdom before construction in order to skip it. The wisdom store is
+//  process-wide: on Pico the constructions on both cores must not overlap
+//  (construct before launching core 1, or import & disable auto tuning); on
+//  the host it is locked, but construct one PicoDCT of the size first so that
+//  the threads don't tune it concurrently.
 //
 //  PLATFORM
 //      Any.
 //
 //  REVISION HISTORY
 //      v0.8    2024-11-09 Initial release.
+//      v0.9    2026-10-18 Static/arena storage, move semantics, no copy.
+//      v0.10   2026-10-18 Unrolled codelets chosen by run-time tuning, see
+//                         DCTWisdom.h.
+//      v0.11   2026-10-18 Strided & interleaved multi-channel transforms.
+//      v0.12   2026-10-18 InputBits(): input width safe from overflow.
+//      v0.13   2026-10-18 Construction vs the shared wisdom store documented.
 //
 //  PROJECT PAGE
 //      https://github.com/RPiks/pico-FDCT
@@ -64,6 +79,11 @@
 
 #include <math.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+
+#include "DCTWisdom.h"
 
 #ifdef PICO_DEFAULT_IRQ_PRIORITY
 #define DCT_PICO_RAM  __not_in_flash_func
@@ -88,31 +108,89 @@ public:
     , _ptbuf(NULL)
     , _n2max(n2max)
     , _piobuf(NULL)
+    , _owner(true)
+    , _leafn2(0)
     {
         ASSERT_(n2max < 13);
 
-        Init();
+        Init(NULL);
+        Plan();
     }
 
-    ~PicoDCT()
+    /// @brief Constructs the object on caller-supplied storage; no heap used.
+    /// @param n2max Max. transform size, 2^n2max.
+    /// @param parena Storage of ArenaWords(n2max) values, e.g. PicoDCTArena.
+    PicoDCT(int n2max, int32_t *parena)
+    : _sin1exp(NULL)
+    , _ptbuf(NULL)
+    , _n2max(n2max)
+    , _piobuf(NULL)
+    , _owner(false)
+    , _leafn2(0)
     {
-        if(_ptbuf)
-        {
-            free(_ptbuf);
-            _ptbuf = NULL;
-        }
+        ASSERT_(n2max < 13);
+        ASSERT_(parena);
 
-        if(_sin1exp)
-        {
-            free(_sin1exp);
-            _sin1exp = NULL;
-        }
+        Init(parena);
+        Plan();
+    }
 
-        if(_piobuf)
+    PicoDCT(const PicoDCT &) = delete;
+    PicoDCT &operator=(const PicoDCT &) = delete;
+
+    PicoDCT(PicoDCT &&other)
+    : _sin1exp(other._sin1exp)
+    , _ptbuf(other._ptbuf)
+    , _n2max(other._n2max)
+    , _piobuf(other._piobuf)
+    , _owner(other._owner)
+    , _leafn2(0)
+    {
+        CopyPlan(other);
+        other.Detach();
+    }
+
+    PicoDCT &operator=(PicoDCT &&other)
+    {
+        if(this != &other)
         {
-            free(_piobuf);
-            _piobuf = NULL;
+            Release();
+
+            _sin1exp = other._sin1exp;
+            _ptbuf = other._ptbuf;
+            _n2max = other._n2max;
+            _piobuf = other._piobuf;
+            _owner = other._owner;
+            CopyPlan(other);
+
+            other.Detach();
         }
+
+        return *this;
+    }
+
+    ~PicoDCT()
+    {
+        Release();
+    }
+
+    /// @brief Size of storage required by the arena constructor.
+    /// @param n2max Max. transform size, 2^n2max.
+    /// @return Number of int32_t values.
+    static constexpr int ArenaWords(int n2max)
+    {
+        return (SIN_PI2_BINS + 1) + (2 << n2max);
+    }
+
+    /// @brief Max. width of signed input samples which can't overflow the
+    /// forward transform of size 2^n, whatever the signal. Measured on the
+    /// worst case (the sign patterns of the basis functions): the headroom
+    /// shrinks by a bit per doubling of the size.
+    /// @param n Length of transform, 2^n values; [2...12].
+    /// @return Bits, |sample| < 2^(bits - 1).
+    static constexpr int InputBits(int n)
+    {
+        return 18 - n;
     }
 
     const int32_t* GetBuf() const
@@ -134,11 +212,151 @@ public:
             return -1;
         }
 
+        _leafn2 = _fwdplan[n];
         FwdTRstep(_piobuf, _ptbuf, n);
 
         return 0;
     }
 
+    /// @brief Forward DCT transform of size 2^n with a fused output stage.
+    /// The final recombination pass hands every output coefficient over to
+    /// the sink as soon as it is calculated, so a post-processing stage (peak
+    /// detection, power accumulation etc) needs no extra pass over the buffer.
+    /// The sink is called as: sink.Begin(n); sink(k, coeff) for k = 0,1,...
+    /// 2^n - 1; sink.End(). The buffer receives the coefficients as usual.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param sink Post-processing stage.
+    /// @return 0 OK; -1 n out of range.
+    template<class TSink>
+    int FwdFDCT(int n, TSink &sink)
+    {
+        if(n < 2 || n > _n2max)
+        {
+            return -1;
+        }
+
+        int32_t *vec = _piobuf;
+        const int32_t *ptmp = _ptbuf;
+        const int len(1 << n);
+        const int halfLen(len >> 1);
+
+        _leafn2 = _fwdplan[n];
+        FwdTRsplit(_piobuf, _ptbuf, n);
+
+        sink.Begin(n);
+        for (int i(0); i < halfLen - 1; ++i)
+        {
+            const int32_t even = ptmp[i];
+            const int32_t odd = ptmp[i + halfLen] + ptmp[i + halfLen + 1];
+            vec[i << 1] = even;
+            vec[(i << 1) + 1] = odd;
+            sink(i << 1, even);
+            sink((i << 1) + 1, odd);
+        }
+
+        vec[len - 2] = ptmp[halfLen - 1];
+        vec[len - 1] = ptmp[len - 1];
+        sink(len - 2, vec[len - 2]);
+        sink(len - 1, vec[len - 1]);
+        sink.End();
+
+        return 0;
+    }
+
+    /// @brief Forward DCT transform of size 2^n of strided data, e.g. of one
+    /// channel of an interleaved I/Q or L/R frame. The samples are gathered by
+    /// the first butterfly pass & the coefficients are scattered by the last
+    /// one, so there is no deinterleaving copy. The io buffer is used as a
+    /// temporary one & its contents are lost.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param psrc Input, sample i is psrc[i * src_stride]; int16_t, int32_t...
+    /// @param src_stride Distance between input samples, elements.
+    /// @param pdst Output, coefficient k goes to pdst[k * dst_stride].
+    /// @param dst_stride Distance between output coefficients, elements.
+    /// @return 0 OK; -1 n out of range.
+    template<typename T>
+    int FwdFDCT(int n, const T *psrc, int src_stride, int32_t *pdst, int dst_stride)
+    {
+        if(n < 2 || n > _n2max)
+        {
+            return -1;
+        }
+
+        const int len(1 << n);
+        const int halfLen(len >> 1);
+        int32_t *ptmp = _ptbuf;
+
+        _leafn2 = _fwdplan[n];
+
+        const T *pend = psrc + (len - 1) * src_stride;
+        for(int i(0); i < halfLen; ++i, psrc += src_stride, pend -= src_stride)
+        {
+            const int32_t x = *psrc;
+            const int32_t y = *pend;
+            ptmp[i] = x + y;
+
+            const int32_t cos_m1 = Cos1Approx1024((i * 102943L + 51471L) >> (n + 2));
+            ptmp[i + halfLen] = ((x - y) * cos_m1) >> 13;
+        }
+
+        FwdTRstep(ptmp, _piobuf, n - 1);
+        FwdTRstep(ptmp + halfLen, _piobuf, n - 1);
+
+        for (int i(0); i < halfLen - 1; ++i)
+        {
+            pdst[0] = ptmp[i];
+            pdst[dst_stride] = ptmp[i + halfLen] + ptmp[i + halfLen + 1];
+            pdst += dst_stride << 1;
+        }
+
+        pdst[0] = ptmp[halfLen - 1];
+        pdst[dst_stride] = ptmp[len - 1];
+
+        return 0;
+    }
+
+    /// @brief Forward DCT transforms of all the channels of interleaved frame,
+    /// each channel gets its own output vector.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param psrc Interleaved frame of 2^n * nch samples.
+    /// @param nch Number of channels, 2 for I/Q or stereo.
+    /// @param ppdst Output vectors of 2^n values, one per channel.
+    /// @return 0 OK; -1 n out of range.
+    template<typename T>
+    int FwdFDCTInterleaved(int n, const T *psrc, int nch, int32_t *const *ppdst)
+    {
+        for(int ch(0); ch < nch; ++ch)
+        {
+            if(FwdFDCT(n, psrc + ch, nch, ppdst[ch], 1))
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+
+    /// @brief Forward DCT transforms of all the channels of interleaved frame,
+    /// the coefficients are interleaved the same way as the input.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param psrc Interleaved frame of 2^n * nch samples.
+    /// @param nch Number of channels, 2 for I/Q or stereo.
+    /// @param pdst Interleaved output of 2^n * nch coefficients.
+    /// @return 0 OK; -1 n out of range.
+    template<typename T>
+    int FwdFDCTInterleaved(int n, const T *psrc, int nch, int32_t *pdst)
+    {
+        for(int ch(0); ch < nch; ++ch)
+        {
+            if(FwdFDCT(n, psrc + ch, nch, pdst + ch, nch))
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+
     /// @brief Recurrent step of forward FDCT.
     /// @param vec Input & output vector.
     /// @param ptmp Temporary vector.
@@ -151,6 +369,34 @@ public:
             return;
         }
 
+        if(n <= _leafn2)
+        {
+            FwdLeaf(vec, n);
+            return;
+        }
+
+        const int len(1 << n);
+        const int halfLen(len >> 1);
+
+        FwdTRsplit(vec, ptmp, n);
+
+        for (int i(0); i < halfLen - 1; ++i)
+        {
+            vec[i << 1] = ptmp[i];
+            vec[(i << 1) + 1] = ptmp[i + halfLen] + ptmp[i + halfLen + 1];
+        }
+
+        vec[len - 2] = ptmp[halfLen - 1];
+        vec[len - 1] = ptmp[len - 1];
+    }
+
+    /// @brief Butterfly & recurrent calls of forward FDCT step; the halves of
+    /// the result are left in the temporary vector for recombination.
+    /// @param vec Input vector, used as temporary one by recurrent calls.
+    /// @param ptmp Output vector.
+    /// @param n Length of transform, 2^n; > 0.
+    inline void FwdTRsplit(int32_t *vec, int32_t *ptmp, int n)
+    {
         const int len(1 << n);
         const int halfLen(len >> 1);
 
@@ -168,15 +414,6 @@ public:
         // Recurrent calls.
         FwdTRstep(ptmp, vec, n - 1);
         FwdTRstep(ptmp + halfLen, vec, n - 1);
-
-        for (int i(0); i < halfLen - 1; ++i)
-        {
-            vec[i << 1] = ptmp[i];
-            vec[(i << 1) + 1] = ptmp[i + halfLen] + ptmp[i + halfLen + 1];
-        }
-
-        vec[len - 2] = ptmp[halfLen - 1];
-        vec[len - 1] = ptmp[len - 1];
     }
 
     /// @brief Inverse DCT transform of size 2^n.
@@ -189,12 +426,86 @@ public:
             return -1;
         }
 
+        _leafn2 = _invplan[n];
         _piobuf[0] >>= 1;
         InvTRstep(_piobuf, _ptbuf, n);
 
         return 0;
     }
 
+    /// @brief Inverse DCT transform of size 2^n of strided coefficients, e.g.
+    /// of one channel of an interleaved frame. The io buffer is used as a
+    /// temporary one & its contents are lost.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param psrc Coefficients, k-th is psrc[k * src_stride].
+    /// @param src_stride Distance between input coefficients, elements.
+    /// @param pdst Output, sample i goes to pdst[i * dst_stride].
+    /// @param dst_stride Distance between output samples, elements.
+    /// @return 0 OK; -1 n out of range.
+    template<typename T>
+    int InvFDCT(int n, const T *psrc, int src_stride, int32_t *pdst, int dst_stride)
+    {
+        if(n < 2 || n > _n2max)
+        {
+            return -1;
+        }
+
+        const int len(1 << n);
+        const int halfLen(len >> 1);
+        int32_t *itmp = _ptbuf;
+
+        _leafn2 = _invplan[n];
+
+        itmp[0] = (int32_t)psrc[0] >> 1;
+        itmp[halfLen] = psrc[src_stride];
+
+        const T *p = psrc + src_stride;
+        for(int i(1); i < halfLen; ++i, p += src_stride << 1)
+        {
+            itmp[i] = p[src_stride];
+            itmp[i + halfLen] = (int32_t)p[0] + (int32_t)p[src_stride << 1];
+        }
+
+        InvTRstep(itmp, _piobuf, n - 1);
+        InvTRstep(itmp + halfLen, _piobuf, n - 1);
+
+        int32_t *pend = pdst + (len - 1) * dst_stride;
+        for (int i(0); i < halfLen; ++i, pdst += dst_stride, pend -= dst_stride)
+        {
+            const int32_t x = itmp[i];
+
+            const int32_t cos_m1 = Cos1Approx1024((i * 102943L + 51471L) >> (n + 2));
+
+            const int32_t y = (itmp[i + halfLen] * cos_m1) >> 13;
+
+            *pdst = x + y;
+            *pend = x - y;
+        }
+
+        return 0;
+    }
+
+    /// @brief Inverse DCT transforms of all the channels of interleaved
+    /// coefficient frame into interleaved output frame.
+    /// @param n Length of transform, 2^n values; [2...12] corresponds (4 to 4096).
+    /// @param psrc Interleaved frame of 2^n * nch coefficients.
+    /// @param nch Number of channels, 2 for I/Q or stereo.
+    /// @param pdst Interleaved output of 2^n * nch samples.
+    /// @return 0 OK; -1 n out of range.
+    template<typename T>
+    int InvFDCTInterleaved(int n, const T *psrc, int nch, int32_t *pdst)
+    {
+        for(int ch(0); ch < nch; ++ch)
+        {
+            if(InvFDCT(n, psrc + ch, nch, pdst + ch, nch))
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+
     /// @brief Recurrent step of inverse FDCT.
     /// @param vec Input & output vector.
     /// @param itmp Temporary vector.
@@ -207,6 +518,12 @@ public:
             return;
         }
 
+        if(n <= _leafn2)
+        {
+            InvLeaf(vec, n);
+            return;
+        }
+
         const int len(1 << n);
         const int halfLen(len >> 1);
 
@@ -237,6 +554,61 @@ public:
         }
     }
 
+    /// @brief Unrolled forward FDCT of length 2 or 4; bit-exact replacement
+    /// of the corresponding FwdTRstep() call.
+    /// @param vec Input & output vector.
+    /// @param n Length of transform, 2^n; 1 or 2.
+    inline void FwdLeaf(int32_t *vec, int n) const
+    {
+        if(n == 1)
+        {
+            const int32_t x = vec[0];
+            const int32_t y = vec[1];
+            vec[0] = x + y;
+            vec[1] = ((x - y) * _leafc[0]) >> 13;
+            return;
+        }
+
+        const int32_t e0 = vec[0] + vec[3];
+        const int32_t o0 = ((vec[0] - vec[3]) * _leafc[1]) >> 13;
+        const int32_t e1 = vec[1] + vec[2];
+        const int32_t o1 = ((vec[1] - vec[2]) * _leafc[2]) >> 13;
+        const int32_t od = ((o0 - o1) * _leafc[0]) >> 13;
+
+        vec[0] = e0 + e1;
+        vec[1] = o0 + o1 + od;
+        vec[2] = ((e0 - e1) * _leafc[0]) >> 13;
+        vec[3] = od;
+    }
+
+    /// @brief Unrolled inverse FDCT of length 2 or 4; bit-exact replacement
+    /// of the corresponding InvTRstep() call.
+    /// @param vec Input & output vector.
+    /// @param n Length of transform, 2^n; 1 or 2.
+    inline void InvLeaf(int32_t *vec, int n) const
+    {
+        if(n == 1)
+        {
+            const int32_t x = vec[0];
+            const int32_t y = (vec[1] * _leafc[0]) >> 13;
+            vec[0] = x + y;
+            vec[1] = x - y;
+            return;
+        }
+
+        const int32_t y0 = (vec[2] * _leafc[0]) >> 13;
+        const int32_t e0 = vec[0] + y0;
+        const int32_t e1 = vec[0] - y0;
+        const int32_t y1 = ((vec[1] + vec[3]) * _leafc[0]) >> 13;
+        const int32_t o0 = (vec[1] + y1) * _leafc[1] >> 13;
+        const int32_t o1 = (vec[1] - y1) * _leafc[2] >> 13;
+
+        vec[0] = e0 + o0;
+        vec[1] = e1 + o1;
+        vec[2] = e1 - o1;
+        vec[3] = e0 - o0;
+    }
+
     /// @brief 1/Cosine approximation.
     /// @param  x an argument +-PI scaled by 2^13.
     /// @return value of 1/cos(x), scaled by 2^12.
@@ -277,18 +649,28 @@ public:
 private:
 
     /// @brief Provides memory allocation & calculates look-up 1/sin(x) table.
-    void Init()
+    /// @param parena Caller-supplied storage or NULL to allocate on heap.
+    void Init(int32_t *parena)
     {
-        _piobuf = (int32_t *)malloc((1 << _n2max) * sizeof(int32_t));
-        ASSERT_(_piobuf);
+        if(parena)
+        {
+            _sin1exp = parena;
+            _piobuf = parena + (SIN_PI2_BINS + 1);
+            _ptbuf = _piobuf + (1 << _n2max);
+        }
+        else
+        {
+            _piobuf = (int32_t *)malloc((1 << _n2max) * sizeof(int32_t));
+            ASSERT_(_piobuf);
 
-        _ptbuf = (int32_t *)malloc((1 << _n2max) * sizeof(int32_t));
-        ASSERT_(_ptbuf);
+            _ptbuf = (int32_t *)malloc((1 << _n2max) * sizeof(int32_t));
+            ASSERT_(_ptbuf);
 
-        // Calculate values & fill array of 1/sin(x).
-        _sin1exp = (int32_t *)malloc((SIN_PI2_BINS + 1) * sizeof(int32_t));
-        ASSERT_(_sin1exp);
+            _sin1exp = (int32_t *)malloc((SIN_PI2_BINS + 1) * sizeof(int32_t));
+            ASSERT_(_sin1exp);
+        }
 
+        // Calculate values & fill array of 1/sin(x).
         for(int i(0); i < (SIN_PI2_BINS + 1); ++i)
         {
             const double dangle = .5 * M_PI * (double)i / (double)(SIN_PI2_BINS);
@@ -297,12 +679,139 @@ private:
 
             _sin1exp[i] = fabs(ddenom) > 1e-12 ? (int32_t)(dnom / ddenom + .0) : 1 << 20;
         }
+
+        // 1/cos factors of unrolled codelets, same as of FwdTRstep().
+        _leafc[0] = Cos1Approx1024(51471L >> 3);
+        _leafc[1] = Cos1Approx1024(51471L >> 4);
+        _leafc[2] = Cos1Approx1024((102943L + 51471L) >> 4);
+    }
+
+    /// @brief Takes the plans of all the sizes from the wisdom store; the
+    /// sizes missing in the store are measured & stored there.
+    void Plan()
+    {
+        DCTWisdom &wisdom = DCTWisdom::Instance();
+        for(int n(0); n < 13; ++n)
+        {
+            _fwdplan[n] = _invplan[n] = 0;
+        }
+
+        for(int n(2); n <= _n2max; ++n)
+        {
+            int fwdleaf, invleaf;
+            if(wisdom.Get(n, &fwdleaf, &invleaf))
+            {
+                if(!wisdom.GetAutoTune())
+                {
+                    continue;
+                }
+
+                Tune(n, &fwdleaf, &invleaf);
+                wisdom.Set(n, fwdleaf, invleaf);
+            }
+
+            _fwdplan[n] = (uint8_t)fwdleaf;
+            _invplan[n] = (uint8_t)invleaf;
+        }
+    }
+
+    /// @brief Measures all the codelet depths for transform of size 2^n & picks
+    /// the fastest ones. Uses the io buffer, so it is done at construction.
+    void Tune(int n, int *pfwdleaf, int *pinvleaf)
+    {
+        const int len(1 << n);
+        const int reps = n < 11 ? 2048 >> n : 1;
+
+        uint64_t fwdbest(~0ULL), invbest(~0ULL);
+        *pfwdleaf = *pinvleaf = 0;
+        for(int leaf(0); leaf <= DCT_LEAF_MAX && leaf < n; ++leaf)
+        {
+            _leafn2 = leaf;
+
+            uint64_t fwdtm(~0ULL), invtm(~0ULL);
+            for(int trial(0); trial < 2; ++trial)
+            {
+                // Timing of integer arithmetic doesn't depend on data, zeros
+                // survive any number of repeated transforms without overflow.
+                memset(_piobuf, 0, len * sizeof(int32_t));
+
+                uint64_t tm = DCTClockMicros();
+                for(int r(0); r < reps; ++r)
+                {
+                    FwdTRstep(_piobuf, _ptbuf, n);
+                }
+                uint64_t dt = DCTClockMicros() - tm;
+                fwdtm = dt < fwdtm ? dt : fwdtm;
+
+                tm = DCTClockMicros();
+                for(int r(0); r < reps; ++r)
+                {
+                    InvTRstep(_piobuf, _ptbuf, n);
+                }
+                dt = DCTClockMicros() - tm;
+                invtm = dt < invtm ? dt : invtm;
+            }
+
+            if(fwdtm < fwdbest)
+            {
+                fwdbest = fwdtm;
+                *pfwdleaf = leaf;
+            }
+            if(invtm < invbest)
+            {
+                invbest = invtm;
+                *pinvleaf = leaf;
+            }
+        }
+
+        _leafn2 = 0;
+    }
+
+    void CopyPlan(const PicoDCT &other)
+    {
+        memcpy(_fwdplan, other._fwdplan, sizeof(_fwdplan));
+        memcpy(_invplan, other._invplan, sizeof(_invplan));
+        memcpy(_leafc, other._leafc, sizeof(_leafc));
+    }
+
+    /// @brief Frees heap storage if the object owns it.
+    void Release()
+    {
+        if(_owner)
+        {
+            free(_ptbuf);
+            free(_sin1exp);
+            free(_piobuf);
+        }
+
+        Detach();
+    }
+
+    /// @brief Forgets storage, e.g. after it was moved to another object.
+    void Detach()
+    {
+        _sin1exp = _ptbuf = _piobuf = NULL;
+        _owner = false;
     }
 
     int32_t *_sin1exp;                                  /* 1 / sin(x) table. */
     int32_t *_ptbuf;                                   /* ptr to tmp buffer. */
-    const int _n2max;                           /* max. transform size, 2^n. */
+    int _n2max;                                 /* max. transform size, 2^n. */
     int32_t *_piobuf;                                /* ptr to input buffer. */
+    bool _owner;                          /* storage is allocated on heap. */
+    int _leafn2;                 /* codelet size of current transform, 2^n. */
+    uint8_t _fwdplan[13];          /* forward codelet size per tr-size, 2^n. */
+    uint8_t _invplan[13];          /* inverse codelet size per tr-size, 2^n. */
+    int32_t _leafc[3];                          /* 1/cos factors of codelets. */
+};
+
+/// @brief Compile-time sized storage for PicoDCT(n2max, parena) constructor.
+/// Declare it static (optionally with a section attribute in order to place
+/// it in a specific RAM bank) & pass `arena.buf` to the constructor.
+template<int N2MAX>
+struct PicoDCTArena
+{
+    int32_t buf[PicoDCT::ArenaWords(N2MAX)];
 };
 
 }
@@ -0,0 +1,356 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  PicoIntDCT.h - Lossless integer-to-integer DCT based on lifting steps.
+//
+//  DESCRIPTION
+//      Maps integer samples to integer coefficients which approximate the
+//  orthonormal DCT-II, the inverse restores the samples bit-exactly. Useful
+//  when the frames are kept in the transform domain but may have to be
+//  reconstructed exactly (record & replay), so no raw copy is needed.
+//      The transform is factored into 2x2 plane rotations only:
+//          DCT-II(N) = pairwise butterflies + DCT-II(N/2) & DCT-IV(N/2),
+//          DCT-IV(M) = pairwise rotations by (2i+1)*pi/4M + two DCT-II(M/2)
+//                      + pairwise butterflies of their outputs,
+//  & every rotation is done by three lifting steps with rounding:
+//          x -= [t*y], y += [s*x], x -= [t*y];  t = tan(a/2), s = sin(a).
+//  Each step is undone by the same step with the opposite sign, so the
+//  inverse is exact whatever the rounding. The rounding errors add up along
+//  the recursion: the coefficients deviate from the true orthonormal DCT by
+//  up to ~1 LSB at N = 4, ~15 LSB at N = 1024 & ~35 LSB at N = 4096.
+//      The coefficients are orthonormal: no rescaling is needed between the
+//  forward & the inverse transform (unlike PicoDCT). 32-bit integer only,
+//  Q13 factors as in PicoDCT; |sample| * sqrt(N) must stay below 2^17, i.e.
+//  12-bit samples are fine for any size up to 4096.
+//
+//  HOWTOSTART
+//      sigproc::PicoIntDCT idct(10);
+//      int32_t *pbuf = idct.SetBuf();
+//      ... put 1024 samples into pbuf ...
+//      idct.FwdIntDCT(10);               // pbuf[] holds the coefficients.
+//      ... keep or encode the coefficients ...
+//      idct.InvIntDCT(10);               // pbuf[] holds the very samples.
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "PicoDCT.h"
+
+namespace sigproc
+{
+
+class PicoIntDCT final
+{
+public:
+    /// @param n2max Max. transform size, 2^n2max; [1...12].
+    PicoIntDCT(int n2max = 12)
+    : _n2max(n2max)
+    , _piobuf(NULL)
+    , _ptbuf(NULL)
+    , _plift(NULL)
+    {
+        ASSERT_(n2max > 0 && n2max < 13);
+
+        Init();
+    }
+
+    PicoIntDCT(const PicoIntDCT &) = delete;
+    PicoIntDCT &operator=(const PicoIntDCT &) = delete;
+
+    ~PicoIntDCT()
+    {
+        free(_piobuf);
+        free(_ptbuf);
+        free(_plift);
+    }
+
+    const int32_t* GetBuf() const
+    {
+        return _piobuf;
+    }
+    int32_t* SetBuf() const
+    {
+        return _piobuf;
+    }
+
+    /// @brief Forward integer DCT of size 2^n, in place.
+    /// @param n Length of transform, 2^n values; [1...n2max].
+    /// @return 0 OK; -1 n out of range.
+    int FwdIntDCT(int n)
+    {
+        if(n < 1 || n > _n2max)
+        {
+            return -1;
+        }
+
+        FwdDCT2(_piobuf, _ptbuf, 1 << n);
+
+        return 0;
+    }
+
+    /// @brief Inverse of FwdIntDCT(n), restores the samples exactly.
+    /// @param n Length of transform, 2^n values; [1...n2max].
+    /// @return 0 OK; -1 n out of range.
+    int InvIntDCT(int n)
+    {
+        if(n < 1 || n > _n2max)
+        {
+            return -1;
+        }
+
+        InvDCT2(_piobuf, _ptbuf, 1 << n);
+
+        return 0;
+    }
+
+private:
+
+    static inline int32_t Lift(int32_t x, int32_t c)
+    {
+        return (x * c + (1 << 12)) >> 13;
+    }
+
+    /// @brief (x, y) -> ((x + y) / sqrt2, (x - y) / sqrt2), a rotation by
+    /// -pi/4 followed by negation of y.
+    static inline void Butterfly(int32_t &x, int32_t &y)
+    {
+        x += Lift(y, kTanPi8);
+        y -= Lift(x, kSinPi4);
+        x += Lift(y, kTanPi8);
+        y = -y;
+    }
+
+    static inline void InvButterfly(int32_t &x, int32_t &y)
+    {
+        y = -y;
+        x -= Lift(y, kTanPi8);
+        y += Lift(x, kSinPi4);
+        x -= Lift(y, kTanPi8);
+    }
+
+    /// @brief Orthonormal DCT-II of len values of vec, ptmp is a scratch of
+    /// the same length.
+    void FwdDCT2(int32_t *vec, int32_t *ptmp, int len)
+    {
+        if(len == 1)
+        {
+            return;
+        }
+
+        if(len == 2)
+        {
+            Butterfly(vec[0], vec[1]);
+            return;
+        }
+
+        const int halfLen(len >> 1);
+        for(int i(0); i < halfLen; ++i)
+        {
+            int32_t x = vec[i];
+            int32_t y = vec[len - 1 - i];
+            Butterfly(x, y);
+            ptmp[i] = x;
+            ptmp[i + halfLen] = y;
+        }
+
+        FwdDCT2(ptmp, vec, halfLen);
+        FwdDCT4(ptmp + halfLen, vec, halfLen);
+
+        for(int i(0); i < halfLen; ++i)
+        {
+            vec[i << 1] = ptmp[i];
+            vec[(i << 1) + 1] = ptmp[i + halfLen];
+        }
+    }
+
+    void InvDCT2(int32_t *vec, int32_t *ptmp, int len)
+    {
+        if(len == 1)
+        {
+            return;
+        }
+
+        if(len == 2)
+        {
+            InvButterfly(vec[0], vec[1]);
+            return;
+        }
+
+        const int halfLen(len >> 1);
+        for(int i(0); i < halfLen; ++i)
+        {
+            ptmp[i] = vec[i << 1];
+            ptmp[i + halfLen] = vec[(i << 1) + 1];
+        }
+
+        InvDCT2(ptmp, vec, halfLen);
+        InvDCT4(ptmp + halfLen, vec, halfLen);
+
+        for(int i(0); i < halfLen; ++i)
+        {
+            int32_t x = ptmp[i];
+            int32_t y = ptmp[i + halfLen];
+            InvButterfly(x, y);
+            vec[i] = x;
+            vec[len - 1 - i] = y;
+        }
+    }
+
+    /// @brief Orthonormal DCT-IV of len values of vec. The pairs (v[i],
+    /// v[len-1-i]) are rotated by -(2i+1)*pi/4len into (a[i], b[i]); then
+    ///     y[0] = A[0], y[len-1] = -B[0],
+    ///     (y[2m], y[2m-1]) = butterfly(A[m], B[len/2-m]),
+    /// where A = DCT-II(a), B = DCT-II((-1)^i * b).
+    void FwdDCT4(int32_t *vec, int32_t *ptmp, int len)
+    {
+        if(len == 1)
+        {
+            return;
+        }
+
+        const int halfLen(len >> 1);
+        const int16_t *plift = _plift + ((halfLen - 1) << 1);
+        for(int i(0); i < halfLen; ++i)
+        {
+            const int32_t t = plift[i << 1];
+            const int32_t s = plift[(i << 1) + 1];
+            int32_t x = vec[i];
+            int32_t y = vec[len - 1 - i];
+            x += Lift(y, t);
+            y -= Lift(x, s);
+            x += Lift(y, t);
+            ptmp[i] = x;
+            ptmp[i + halfLen] = i & 1 ? -y : y;
+        }
+
+        FwdDCT2(ptmp, vec, halfLen);
+        FwdDCT2(ptmp + halfLen, vec, halfLen);
+
+        vec[0] = ptmp[0];
+        vec[len - 1] = -ptmp[halfLen];
+        for(int m(1); m < halfLen; ++m)
+        {
+            int32_t x = ptmp[m];
+            int32_t y = ptmp[len - m];
+            Butterfly(x, y);
+            vec[m << 1] = x;
+            vec[(m << 1) - 1] = y;
+        }
+    }
+
+    void InvDCT4(int32_t *vec, int32_t *ptmp, int len)
+    {
+        if(len == 1)
+        {
+            return;
+        }
+
+        const int halfLen(len >> 1);
+        ptmp[0] = vec[0];
+        ptmp[halfLen] = -vec[len - 1];
+        for(int m(1); m < halfLen; ++m)
+        {
+            int32_t x = vec[m << 1];
+            int32_t y = vec[(m << 1) - 1];
+            InvButterfly(x, y);
+            ptmp[m] = x;
+            ptmp[len - m] = y;
+        }
+
+        InvDCT2(ptmp, vec, halfLen);
+        InvDCT2(ptmp + halfLen, vec, halfLen);
+
+        const int16_t *plift = _plift + ((halfLen - 1) << 1);
+        for(int i(0); i < halfLen; ++i)
+        {
+            const int32_t t = plift[i << 1];
+            const int32_t s = plift[(i << 1) + 1];
+            int32_t x = ptmp[i];
+            int32_t y = i & 1 ? -ptmp[i + halfLen] : ptmp[i + halfLen];
+            x -= Lift(y, t);
+            y += Lift(x, s);
+            x -= Lift(y, t);
+            vec[i] = x;
+            vec[len - 1 - i] = y;
+        }
+    }
+
+    /// @brief Provides memory allocation & calculates lifting factors of
+    /// DCT-IV rotations for all the sizes.
+    void Init()
+    {
+        const int len(1 << _n2max);
+
+        _piobuf = (int32_t *)malloc(len * sizeof(int32_t));
+        ASSERT_(_piobuf);
+
+        _ptbuf = (int32_t *)malloc(len * sizeof(int32_t));
+        ASSERT_(_ptbuf);
+
+        // DCT-IV of size M takes M/2 (tan, sin) pairs starting at pair M/2-1.
+        const int pairs = len > 2 ? (len >> 1) - 1 : 1;
+        _plift = (int16_t *)malloc(2 * pairs * sizeof(int16_t));
+        ASSERT_(_plift);
+
+        for(int m(2); m < len; m <<= 1)
+        {
+            int16_t *plift = _plift + ((m >> 1) - 1) * 2;
+            for(int i(0); i < (m >> 1); ++i)
+            {
+                const double dangle = M_PI * (double)(2 * i + 1) / (double)(4 * m);
+                plift[i << 1] = (int16_t)floor(8192. * tan(.5 * dangle) + .5);
+                plift[(i << 1) + 1] = (int16_t)floor(8192. * sin(dangle) + .5);
+            }
+        }
+    }
+
+    static const int32_t kTanPi8 = 3393;         /* tan(pi/8) scaled by 2^13. */
+    static const int32_t kSinPi4 = 5793;         /* sin(pi/4) scaled by 2^13. */
+
+    const int _n2max;                              /* max. transform size. */
+    int32_t *_piobuf;                                 /* input/output data. */
+    int32_t *_ptbuf;                                     /* scratch buffer. */
+    int16_t *_plift;                  /* DCT-IV lifting factors, Q13 pairs. */
+};
+
+}
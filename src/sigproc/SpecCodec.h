@@ -0,0 +1,374 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  SpecCodec.h - Compact quantized format of PicoDCT coefficient frames.
+//
+//  DESCRIPTION
+//      Packs a frame of FDCT coefficients into a small binary record suitable
+//  for logging & transport. The spectrum is split into 2^k equal bands, each
+//  band has its own quantizer step (a power of two, i.e. a right shift). The
+//  quantized values are coded as variable length integers; coefficients that
+//  were trimmed to zero are coded as zero runs, so a sparse spectrum shrinks
+//  to a few bytes per significant bin.
+//      Only integer shifts, adds & compares are used both in the encoder and
+//  in the decoder. The decoder writes dequantized values straight into the
+//  target buffer, e.g. PicoDCT::SetBuf(), ready for InvFDCT().
+//
+//      Frame layout:
+//          uint8_t  magic           0xDC
+//          uint8_t  n2 | (k << 4)   frame length 2^n2, 2^k bands
+//          uint8_t  shift[1 << k]   per-band quantizer shifts
+//          varint   payload size, bytes
+//          varint   token[...]      (zigzag(q) << 1) | 0 - one value q != 0,
+//                                                         |q| < 2^30
+//                                   (run << 1) | 1      - run of zeros
+//
+//  HOWTOSTART
+//      sigproc::SpecCodec codec(10, 3);      // 1024 bins, 8 bands.
+//      codec.AutoShifts(pdct.GetBuf(), 8);   // keep 8 MSBs in every band.
+//      const int sz = codec.Encode(pdct.GetBuf(), pframe, sizeof(pframe));
+//      ...
+//      sigproc::SpecCodec::Decode(pframe, sz, pdct.SetBuf(), 10);
+//
+//  PLATFORM
+//      Any.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//      Rev 0.2   18 Oct 2026   Encode() rejects values out of token range.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+#ifndef ASSERT_
+#define ASSERT_(x) assert(x)
+#endif
+
+#define SPEC_MAGIC 0xDC                             /* Frame magic byte. */
+#define SPEC_MAX_LOGBANDS 6                 /* No more than 64 bands. */
+
+namespace sigproc
+{
+
+class SpecCodec final
+{
+public:
+    /// @param n2 Length of frame, 2^n values; [2...12].
+    /// @param lognbands Number of quantizer bands, 2^lognbands; <= n2.
+    SpecCodec(int n2 = 10, int lognbands = 3)
+    : _n2(n2)
+    , _lognb(lognbands)
+    {
+        ASSERT_(n2 >= 2 && n2 < 13);
+        ASSERT_(lognbands >= 0 && lognbands <= SPEC_MAX_LOGBANDS && lognbands <= n2);
+
+        for(int i(0); i < (1 << SPEC_MAX_LOGBANDS); ++i)
+        {
+            _shift[i] = 0;
+        }
+    }
+
+    /// @brief Worst case size of encoded frame (incompressible noise).
+    static int MaxFrameSize(int n2, int lognbands)
+    {
+        return 2 + (1 << lognbands) + 5 + 5 * (1 << n2);
+    }
+
+    /// @brief Sets quantizer step of a band to 2^shift.
+    void SetShift(int band, int shift)
+    {
+        ASSERT_(band >= 0 && band < (1 << _lognb));
+        ASSERT_(shift >= 0 && shift < 32);
+
+        _shift[band] = (uint8_t)shift;
+    }
+
+    int GetShift(int band) const
+    {
+        return _shift[band];
+    }
+
+    /// @brief Chooses band shifts so that the peak of every band keeps
+    /// `keepbits` significant bits; the rest of the band is quantized
+    /// accordingly & small coefficients fall to zero.
+    /// @param pcoeffs Coefficient frame, 2^n2 values.
+    /// @param keepbits Significant bits to keep, [1...29]; larger values are
+    /// taken as 29, so that the rounded values stay in the token range.
+    void AutoShifts(const int32_t *pcoeffs, int keepbits)
+    {
+        keepbits = keepbits < 29 ? keepbits : 29;
+        const int bandlen = 1 << (_n2 - _lognb);
+        for(int b(0); b < (1 << _lognb); ++b)
+        {
+            uint32_t umax(0);
+            for(int i(0); i < bandlen; ++i)
+            {
+                umax |= Abs(pcoeffs[i]);
+            }
+            pcoeffs += bandlen;
+
+            int nbits(0);
+            while(umax >> nbits)
+            {
+                ++nbits;
+            }
+
+            _shift[b] = nbits > keepbits ? (uint8_t)(nbits - keepbits) : 0;
+        }
+    }
+
+    /// @brief Quantizes & encodes a coefficient frame.
+    /// @param pcoeffs Coefficient frame, 2^n2 values.
+    /// @param pdst Output buffer.
+    /// @param dstsize Size of output buffer, MaxFrameSize() is always enough.
+    /// @return > 0 frame size, bytes; -1 no room in output buffer; -2 a
+    /// quantized value is out of the token range, |q| >= 2^30 (use larger
+    /// shifts).
+    int Encode(const int32_t *pcoeffs, uint8_t *pdst, int dstsize) const
+    {
+        const int nbands = 1 << _lognb;
+        const int hdrsize = 2 + nbands + 5;
+        if(dstsize < hdrsize)
+        {
+            return -1;
+        }
+
+        pdst[0] = SPEC_MAGIC;
+        pdst[1] = (uint8_t)(_n2 | (_lognb << 4));
+        for(int b(0); b < nbands; ++b)
+        {
+            pdst[2 + b] = _shift[b];
+        }
+
+        // The payload size is known only at the end: reserve 5 bytes & move
+        // the payload back when the actual size takes less.
+        uint8_t *p = pdst + hdrsize;
+        const uint8_t *pend = pdst + dstsize;
+
+        const int bandlen = 1 << (_n2 - _lognb);
+        uint32_t run(0);
+        for(int b(0); b < nbands; ++b)
+        {
+            const int shift = _shift[b];
+            const int64_t half = shift ? 1LL << (shift - 1) : 0;
+            for(int i(0); i < bandlen; ++i)
+            {
+                // 64-bit rounding: no overflow near INT32_MIN/MAX.
+                const int64_t v = *pcoeffs++;
+                int64_t q = v >= 0 ? (v + half) >> shift : -((half - v) >> shift);
+                if(q > (INT32_MAX >> shift))
+                {
+                    --q;                 /* rounded up past the int32 range. */
+                }
+                if(q >= (1LL << 30) || q <= -(1LL << 30))
+                {
+                    return -2;
+                }
+                if(!q)
+                {
+                    ++run;
+                    continue;
+                }
+
+                if(run)
+                {
+                    if(pend - p < 10)
+                    {
+                        return -1;
+                    }
+                    p = PutVarint(p, (run << 1) | 1U);
+                    run = 0;
+                }
+                else if(pend - p < 5)
+                {
+                    return -1;
+                }
+
+                p = PutVarint(p, ZigZag((int32_t)q) << 1);
+            }
+        }
+
+        if(run)
+        {
+            if(pend - p < 5)
+            {
+                return -1;
+            }
+            p = PutVarint(p, (run << 1) | 1U);
+        }
+
+        const uint32_t payload = p - (pdst + hdrsize);
+        uint8_t *psz = PutVarint(pdst + 2 + nbands, payload);
+        const int gap = (pdst + hdrsize) - psz;
+        if(gap)
+        {
+            for(uint32_t i(0); i < payload; ++i)
+            {
+                psz[i] = psz[i + gap];
+            }
+        }
+
+        return hdrsize - gap + payload;
+    }
+
+    /// @brief Decodes a frame & dequantizes it into the output buffer.
+    /// @param psrc Encoded frame.
+    /// @param srcsize Size of encoded frame, bytes.
+    /// @param pdst Output buffer, e.g. PicoDCT::SetBuf().
+    /// @param n2max Capacity of output buffer, 2^n2max values.
+    /// @return n2 of decoded frame; -1 not a frame; -2 frame is too long for
+    /// the buffer; -3 frame is truncated or corrupted.
+    static int Decode(const uint8_t *psrc, int srcsize, int32_t *pdst, int n2max)
+    {
+        if(srcsize < 3 || psrc[0] != SPEC_MAGIC)
+        {
+            return -1;
+        }
+
+        const int n2 = psrc[1] & 0x0F;
+        const int lognb = psrc[1] >> 4;
+        if(n2 < 2 || n2 > n2max || lognb > SPEC_MAX_LOGBANDS || lognb > n2)
+        {
+            return -2;
+        }
+
+        const int nbands = 1 << lognb;
+        const uint8_t *pshift = psrc + 2;
+        const uint8_t *p = pshift + nbands;
+        const uint8_t *pend = psrc + srcsize;
+
+        uint32_t payload;
+        if(p >= pend || !(p = GetVarint(p, pend, &payload))
+           || (uint32_t)(pend - p) < payload)
+        {
+            return -3;
+        }
+        pend = p + payload;
+
+        for(int b(0); b < nbands; ++b)
+        {
+            if(pshift[b] > 31)
+            {
+                return -3;
+            }
+        }
+
+        const int len = 1 << n2;
+        const int bandshift = n2 - lognb;
+        int k(0);
+        while(k < len)
+        {
+            uint32_t token;
+            if(!(p = GetVarint(p, pend, &token)))
+            {
+                return -3;
+            }
+
+            if(token & 1)
+            {
+                const uint32_t run = token >> 1;
+                if(!run || run > (uint32_t)(len - k))
+                {
+                    return -3;
+                }
+                for(uint32_t i(0); i < run; ++i)
+                {
+                    pdst[k++] = 0;
+                }
+            }
+            else
+            {
+                const uint32_t zz = token >> 1;
+                const int32_t q = (int32_t)(zz >> 1) ^ -(int32_t)(zz & 1);
+                // Unsigned product: no UB on negative or corrupt values.
+                pdst[k] = (int32_t)((uint32_t)q * (1U << pshift[k >> bandshift]));
+                ++k;
+            }
+        }
+
+        return p == pend ? n2 : -3;
+    }
+
+private:
+
+    static inline uint32_t Abs(int32_t v)
+    {
+        return v < 0 ? -(uint32_t)v : (uint32_t)v;
+    }
+
+    static inline uint32_t ZigZag(int32_t v)
+    {
+        return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+    }
+
+    static inline uint8_t *PutVarint(uint8_t *p, uint32_t v)
+    {
+        while(v >= 0x80)
+        {
+            *p++ = (uint8_t)(v | 0x80);
+            v >>= 7;
+        }
+        *p++ = (uint8_t)v;
+
+        return p;
+    }
+
+    /// @return ptr past the value or NULL if it is truncated.
+    static inline const uint8_t *GetVarint(const uint8_t *p, const uint8_t *pend,
+                                           uint32_t *pv)
+    {
+        uint32_t v(0);
+        for(int sh(0); sh < 35 && p < pend; sh += 7)
+        {
+            const uint8_t b = *p++;
+            v |= (uint32_t)(b & 0x7F) << sh;
+            if(!(b & 0x80))
+            {
+                *pv = v;
+                return p;
+            }
+        }
+
+        return NULL;
+    }
+
+    const int _n2;                                /* frame length, 2^n2. */
+    const int _lognb;                       /* number of bands, 2^lognb. */
+    uint8_t _shift[1 << SPEC_MAX_LOGBANDS];  /* per-band quantizer shifts. */
+};
+
+}
@@ -67,6 +67,7 @@
 #include <defines.h>
 #include <init.h>
 #include <StampPrintf.h>
+#include <TraceLog.h>
 #include <utility.h>
 #include <PicoDCT.h>
 
@@ -143,10 +144,12 @@ int main()
         // Edit this formula if you do prefer other method of quality assessment.
         const float errdb = 20.f * std::log10(f_acc2 / (float)dpkpk);
 
-        dbg::StampPrintf("Forward DCT-%ld conversion time: %ld micros.", len, ifwdcdt);
-        dbg::StampPrintf("Inverse DCT-%ld conversion time: %ld micros.", len, (int32_t)(tm_finish - tm_start));
+        dbg::Trace(dbg::TRC_FWD_DCT_TIME, len, ifwdcdt);
+        dbg::Trace(dbg::TRC_INV_DCT_TIME, len, (int32_t)(tm_finish - tm_start));
         dbg::StampPrintf("Forward -> inverse transform error stats: Vpk-pk: %ld, Error.Std.dev:%f, SNR:%.1f dBFS", dpkpk, f_acc2, errdb);
 
+        dbg::TraceDrainText(16);
+
         sleep_ms(3000);
     }
 }
@@ -52,7 +52,7 @@
 namespace utl
 {
 
-uint64_t GetUptime64(void)
+inline uint64_t GetUptime64(void)
 {
     const uint32_t lo = timer_hw->timelr;
     const uint32_t hi = timer_hw->timehr;
@@ -60,22 +60,22 @@ uint64_t GetUptime64(void)
     return ((uint64_t)hi << 32U) | lo;
 }
 
-uint32_t GetTime32(void)
+inline uint32_t GetTime32(void)
 {
     return timer_hw->timelr;
 }
 
-uint32_t PicoU64timeToSeconds(const uint64_t &u64tm)
+inline uint32_t PicoU64timeToSeconds(const uint64_t &u64tm)
 {
     return u64tm / 1000000U;    // No rounding deliberately!
 }
 
-uint32_t DecimalStr2ToNumber(const char *p)
+inline uint32_t DecimalStr2ToNumber(const char *p)
 {
     return 10U * (p[0] - '0') + (p[1] - '0');
 }
 
-void PRN32(uint32_t *val)
+inline void PRN32(uint32_t *val)
 { 
     *val ^= *val << 13;
     *val ^= *val >> 17;
@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  codecchk.cpp - Host encode/decode round trip check of SpecCodec.
+//
+//  DESCRIPTION
+//      Encodes frames & decodes them back, comparing every value with the
+//  reference quantization (round half away from zero to a multiple of the
+//  band step, never above INT32_MAX):
+//      - extreme values, +-(2^30 - 1) at shift 0 & INT32_MIN/MAX at every
+//        shift;
+//      - values out of the token range, which Encode() must reject;
+//      - random frames of every size & band count with random shifts,
+//        sparse & dense;
+//      - truncated & corrupted frames, which Decode() must reject.
+//  Prints the failed cases; exit code is 0 when there are none.
+//
+//  HOWTOSTART
+//      g++ -O2 -std=c++11 -I../src/sigproc codecchk.cpp -o codecchk
+//      ./codecchk
+//
+//  PLATFORM
+//      Any host.
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <SpecCodec.h>
+
+namespace
+{
+
+int gFailed = 0;
+
+void Check(bool ok, const char *what, int n2, int lognb)
+{
+    if(!ok)
+    {
+        ++gFailed;
+        printf("FAIL %s (n2=%d, bands 2^%d)\n", what, n2, lognb);
+    }
+}
+
+/// @brief Reference quantization of v with step 2^shift.
+int64_t Quantize(int32_t v, int shift)
+{
+    const int64_t step = 1LL << shift;
+    const int64_t a = v < 0 ? -(int64_t)v : (int64_t)v;
+    int64_t q = (a + (step >> 1)) / step;
+    if(v >= 0 && q * step > INT32_MAX)
+    {
+        --q;
+    }
+
+    return v < 0 ? -q : q;
+}
+
+/// @brief Encodes & decodes a frame, compares with the reference. A frame
+/// with a quantized value out of the token range must be rejected.
+/// @return Encode() result.
+int RoundTrip(sigproc::SpecCodec &codec, const std::vector<int32_t> &frame,
+              int n2, int lognb, const char *what)
+{
+    const int bandshift = n2 - lognb;
+    bool fits(true);
+    for(size_t k(0); k < frame.size(); ++k)
+    {
+        const int64_t q = Quantize(frame[k], codec.GetShift(k >> bandshift));
+        fits = fits && q < (1LL << 30) && q > -(1LL << 30);
+    }
+
+    std::vector<uint8_t> buf(sigproc::SpecCodec::MaxFrameSize(n2, lognb));
+    const int sz = codec.Encode(frame.data(), buf.data(), (int)buf.size());
+    Check(fits ? sz > 0 : sz == -2, what, n2, lognb);
+    if(sz < 0)
+    {
+        return sz;
+    }
+
+    std::vector<int32_t> out(frame.size(), 0x5A5A5A5A);
+    Check(sigproc::SpecCodec::Decode(buf.data(), sz, out.data(), n2) == n2,
+          what, n2, lognb);
+
+    bool same(true);
+    for(size_t k(0); k < frame.size(); ++k)
+    {
+        const int shift = codec.GetShift(k >> bandshift);
+        same = same && out[k] == Quantize(frame[k], shift) * (1LL << shift);
+    }
+    Check(same, what, n2, lognb);
+
+    // Every truncation must be rejected.
+    for(int cut(0); cut < sz; ++cut)
+    {
+        if(sigproc::SpecCodec::Decode(buf.data(), cut, out.data(), n2) >= 0)
+        {
+            Check(false, "truncated frame accepted", n2, lognb);
+            break;
+        }
+    }
+
+    return sz;
+}
+
+int32_t Random32()
+{
+    return (int32_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand());
+}
+
+}
+
+int main()
+{
+    srand(1);
+
+    // Extreme values.
+    {
+        sigproc::SpecCodec codec(2, 0);
+        std::vector<int32_t> frame = { (1 << 30) - 1, -(1 << 30) + 1, 5, 0 };
+        Check(RoundTrip(codec, frame, 2, 0, "+-(2^30 - 1) at shift 0") > 0,
+              "+-(2^30 - 1) not encoded", 2, 0);
+
+        frame = { 0x40000000, -0x40000001, 5, 0 };
+        Check(RoundTrip(codec, frame, 2, 0, "2^30 at shift 0") == -2,
+              "2^30 at shift 0 not rejected", 2, 0);
+        frame = { 0, -0x40000000, 5, 0 };
+        Check(RoundTrip(codec, frame, 2, 0, "-2^30 at shift 0") == -2,
+              "-2^30 at shift 0 not rejected", 2, 0);
+
+        for(int shift(1); shift < 32; ++shift)
+        {
+            codec.SetShift(0, shift);
+            frame = { INT32_MAX, INT32_MIN, INT32_MAX - 1, INT32_MIN + 1 };
+            RoundTrip(codec, frame, 2, 0, "INT32_MIN/MAX");
+            frame = { INT32_MAX, INT32_MAX - 1, -1, INT32_MAX };
+            Check(RoundTrip(codec, frame, 2, 0, "INT32_MAX") > 0,
+                  "INT32_MAX not encoded", 2, 0);
+        }
+    }
+
+    // Random frames: full range with AutoShifts, sparse, small values.
+    for(int n2(2); n2 <= 12; ++n2)
+    {
+        for(int lognb(0); lognb <= SPEC_MAX_LOGBANDS && lognb <= n2; ++lognb)
+        {
+            sigproc::SpecCodec codec(n2, lognb);
+            std::vector<int32_t> frame(1 << n2);
+            for(int pass(0); pass < 4; ++pass)
+            {
+                for(size_t k(0); k < frame.size(); ++k)
+                {
+                    const int32_t r = Random32();
+                    frame[k] = pass == 0 ? r
+                             : pass == 1 ? (rand() % 16 ? 0 : r >> (rand() % 31))
+                             : r >> (rand() % 32);
+                }
+
+                if(pass == 3)
+                {
+                    for(int b(0); b < (1 << lognb); ++b)
+                    {
+                        codec.SetShift(b, rand() % 32);
+                    }
+                }
+                else
+                {
+                    codec.AutoShifts(frame.data(), 1 + rand() % 31);
+                }
+
+                const int sz = RoundTrip(codec, frame, n2, lognb, "random frame");
+                Check(pass == 3 || sz > 0, "AutoShifts() out of range", n2,
+                      lognb);
+            }
+        }
+    }
+
+    // Corrupted frames: a wrong shift byte & a run over the frame length.
+    {
+        sigproc::SpecCodec codec(4, 1);
+        std::vector<int32_t> frame(16, 0);
+        frame[3] = 100;
+        uint8_t buf[64];
+        const int sz = codec.Encode(frame.data(), buf, sizeof(buf));
+        int32_t out[16];
+        Check(sz > 0 && sigproc::SpecCodec::Decode(buf, sz, out, 4) == 4,
+              "sparse frame", 4, 1);
+
+        buf[2] = 32;
+        Check(sigproc::SpecCodec::Decode(buf, sz, out, 4) == -3,
+              "band shift > 31 accepted", 4, 1);
+        buf[2] = 0;
+
+        buf[sz - 1] += 2;                  /* the final run gets one longer. */
+        Check(sigproc::SpecCodec::Decode(buf, sz, out, 4) == -3,
+              "run over the frame accepted", 4, 1);
+        Check(sigproc::SpecCodec::Decode(buf, sz, out, 3) == -2,
+              "frame longer than buffer accepted", 4, 1);
+    }
+
+    printf("%s\n", gFailed ? "FAIL" : "PASS");
+
+    return gFailed ? 1 : 0;
+}
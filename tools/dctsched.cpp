@@ -0,0 +1,268 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  dctsched.cpp - Host simulation of DCTScheduler under a load burst.
+//
+//  DESCRIPTION
+//      Measures the median cost of a full size frame (forward FDCT,
+//  processing & inverse FDCT), sets the frame budget to four times of it &
+//  runs three phases: calm, a burst of extra processing load proportional to
+//  the number of coefficients (the full size frame takes ~2 budgets), calm
+//  again. Prints the level of every frame (one digit per frame) & the
+//  statistics. The budget has a wide margin since the host is not a
+//  real-time system.
+//      Without the scheduler every frame of the burst would miss. Exit code
+//  is 0 when:
+//      - the misses are below 5% of the burst;
+//      - after a settling window, at least 3/4 of the recovery frames are
+//        processed at full size;
+//      - the output tone has the same amplitude (within 10%) at every level
+//        which does the inverse. The amplitude is the least squares gain of
+//        output vs input, the errors of PicoDCT at small inputs don't count;
+//      - a tone at 0.9 of the Nyquist frequency of the smallest inverse,
+//        each level forced by SetLevel(), droops as the group sums & the
+//        hold predict: the gain vs level 0 is H^2 (within 10%), where
+//        H = sin(pi*f*L) / (L*sin(pi*f)), L = 2^l; the degraded levels
+//        don't low-pass the input.
+//
+//  HOWTOSTART
+//      g++ -O2 -std=c++11 -I../src/sigproc dctsched.cpp -o dctsched
+//      ./dctsched [n2]                          // n2 = 8...12, 10 default.
+//
+//  PLATFORM
+//      POSIX host (Linux, macOS).
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//      Rev 0.2   18 Oct 2026   Droop check of a tone near the new Nyquist.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+
+#include <algorithm>
+
+#include <DCTScheduler.h>
+
+namespace
+{
+
+/// @brief Fills a tone of f cycles per sample, the amplitude is within the
+/// headroom of PicoDCT.
+void Tone(int32_t *pdst, int n2, double f)
+{
+    const double dampl = (double)((1 << (sigproc::PicoDCT::InputBits(n2) - 1)) - 1);
+    for(int i(0); i < (1 << n2); ++i)
+    {
+        pdst[i] = (int32_t)floor(dampl * sin(2. * M_PI * f * (double)i) + .5);
+    }
+}
+
+/// @brief Least squares gain of output vs input.
+double Gain(const int32_t *pin, const int32_t *pout, int len)
+{
+    double num(0.), den(0.);
+    for(int j(0); j < len; ++j)
+    {
+        num += (double)pout[j] * (double)pin[j];
+        den += (double)pin[j] * (double)pin[j];
+    }
+
+    return den > 0. ? num / den : 0.;
+}
+
+const int kCalibFrames = 64;
+const int kCalmFrames = 200;
+const int kBurstFrames = 150;
+const int kRecoverFrames = 600;
+const int kSettleFrames = 64;
+
+/// @brief Scales the coefficients for the inverse (see PicoDCT.h) & burns
+/// the extra time of the burst.
+struct LoadProc
+{
+    uint32_t us_per_coeff_q8;                   /* extra load, us * 2^8. */
+
+    void operator()(int32_t *pcoeffs, int n)
+    {
+        for(int i(0); i < (1 << n); ++i)
+        {
+            pcoeffs[i] >>= 3;
+        }
+
+        const uint64_t tm_end = sigproc::DCTClockMicros()
+                                + ((us_per_coeff_q8 << n) >> 8);
+        while(sigproc::DCTClockMicros() < tm_end)
+        {
+        }
+    }
+};
+
+}
+
+int main(int argc, char **argv)
+{
+    const int n2 = argc > 1 ? atoi(argv[1]) : 10;
+    if(n2 < 8 || n2 > 12)
+    {
+        fprintf(stderr, "usage: %s [n2 = 8...12]\n", argv[0]);
+        return 2;
+    }
+
+    const int len(1 << n2);
+    int32_t *pin = (int32_t *)malloc(len * sizeof(int32_t));
+    int32_t *pout = (int32_t *)malloc(len * sizeof(int32_t));
+    // Slow tone, the sums of degraded levels barely attenuate it.
+    Tone(pin, n2, 1. / 64.);
+
+    sigproc::PicoDCT pdct(n2);
+    LoadProc proc = { 0 };
+
+    // Calibration: the median of several full size frames.
+    sigproc::DCTScheduler calib(pdct, n2, ~0U);
+    uint32_t cost_us[kCalibFrames];
+    for(int i(0); i < kCalibFrames; ++i)
+    {
+        calib.Frame(pin, pout, proc);
+        cost_us[i] = calib.GetStats().last_us;
+    }
+    std::sort(cost_us, cost_us + kCalibFrames);
+    const uint32_t full_us = cost_us[kCalibFrames / 2] ? cost_us[kCalibFrames / 2] : 1;
+
+    const uint32_t budget = 4 * full_us;
+    sigproc::DCTScheduler sched(pdct, n2, budget);
+    printf("n2=%d full frame %u us, budget %u us, levels 0...%d\n", n2,
+           full_us, budget, sched.MaxLevel());
+
+    const int phases[3] = { kCalmFrames, kBurstFrames, kRecoverFrames };
+    const char *names[3] = { "calm", "burst", "recovery" };
+    int burst_missed(0), recovered(0);
+    double gnum[DCT_SCHED_MAXSHIFT + 2] = { 0 };
+    double gden[DCT_SCHED_MAXSHIFT + 2] = { 0 };
+    for(int p(0); p < 3; ++p)
+    {
+        // The burst: full size frame costs ~2 budgets.
+        proc.us_per_coeff_q8 = p == 1 ? (2 * budget << 8) / len : 0;
+
+        const uint32_t missed0 = sched.GetStats().missed;
+        printf("%-9s", names[p]);
+        for(int i(0); i < phases[p]; ++i)
+        {
+            const int level = sched.Frame(pin, pout, proc);
+            if(level < 0)
+            {
+                fprintf(stderr, "transform error\n");
+                return 1;
+            }
+            recovered += p == 2 && i >= kSettleFrames && !level;
+            if(!sched.LevelSkipsInverse(level))
+            {
+                for(int j(0); j < len; ++j)
+                {
+                    gnum[level] += (double)pout[j] * (double)pin[j];
+                    gden[level] += (double)pin[j] * (double)pin[j];
+                }
+            }
+            printf("%s%d", i && !(i % 100) ? "\n         " : "", level);
+        }
+        printf("\n");
+
+        if(p == 1)
+        {
+            burst_missed = (int)(sched.GetStats().missed - missed0);
+        }
+    }
+
+    const sigproc::DCTSchedStats &st = sched.GetStats();
+    printf("frames %u, missed %u (burst %d), degraded %u, inverse skipped %u\n",
+           st.frames, st.missed, burst_missed, st.degraded, st.skipped_inv);
+    printf("downgrades %u, upgrades %u, worst %u us\n", st.downgrades,
+           st.upgrades, st.worst_us);
+    const double gain0 = gden[0] > 0. ? gnum[0] / gden[0] : 0.;
+    bool scale_ok(gain0 > 0.);
+    for(int l(0); l <= sched.MaxLevel(); ++l)
+    {
+        printf("level %d (2^%d%s): %u frames", l, sched.LevelN2(l),
+               sched.LevelSkipsInverse(l) ? ", no inverse" : "",
+               st.level_frames[l]);
+        if(gden[l] > 0.)
+        {
+            const double gain = gnum[l] / gden[l];
+            printf(", output/input %.1f", gain);
+            scale_ok = scale_ok && fabs(gain - gain0) <= .1 * gain0;
+        }
+        printf("\n");
+    }
+
+    // A tone near the top of the smallest inverse: the droop of every level
+    // vs the prediction of the boxcar sums & the hold.
+    int maxinv(0);
+    while(maxinv < sched.MaxLevel() && !sched.LevelSkipsInverse(maxinv + 1))
+    {
+        ++maxinv;
+    }
+    const double ftop = .9 / (double)(2 << maxinv);
+    Tone(pin, n2, ftop);
+    sigproc::DCTScheduler probe(pdct, n2, ~0U);
+    double gtop0(0.);
+    bool droop_ok(true);
+    printf("tone %.4f cycles/sample:", ftop);
+    for(int l(0); l <= maxinv; ++l)
+    {
+        probe.SetLevel(l);
+        if(probe.Frame(pin, pout, proc) != l)
+        {
+            fprintf(stderr, "transform error\n");
+            return 1;
+        }
+
+        const double gain = Gain(pin, pout, len);
+        gtop0 = l ? gtop0 : gain;
+        const double grp = (double)(1 << l);
+        const double h = sin(M_PI * ftop * grp) / (grp * sin(M_PI * ftop));
+        printf(" level %d %.2f (%.2f)", l, gain / gtop0, h * h);
+        droop_ok = droop_ok && gtop0 > 0. && fabs(gain / gtop0 - h * h) <= .1 * h * h;
+    }
+    printf("\n");
+
+    free(pin);
+    free(pout);
+
+    const bool ok = burst_missed <= kBurstFrames / 20 && scale_ok && droop_ok
+                    && recovered * 4 >= (kRecoverFrames - kSettleFrames) * 3;
+    printf("%s\n", ok ? "PASS" : "FAIL");
+
+    return ok ? 0 : 1;
+}
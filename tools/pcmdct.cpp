@@ -0,0 +1,392 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  pcmdct.cpp - Host batch tool: transforms PCM/WAV recordings with PicoDCT.
+//
+//  DESCRIPTION
+//      Memory-maps a raw PCM or WAV recording (16, 24 or 32-bit signed LE;
+//  WAVE_FORMAT_EXTENSIBLE only with PCM SubFormat, float WAVs are refused),
+//  cuts it into frames of 2^n samples with a configurable hop, runs forward
+//  FDCT of every frame and stores coefficient frames into a memory-mapped
+//  output file. Frames are distributed over several worker threads, each of
+//  them owns its own PicoDCT instance, so there is no locking at all.
+//      No read() into intermediate buffers is performed: the samples are
+//  taken straight from the page cache & converted to the transform's input
+//  width (PicoDCT::InputBits(n2) bits by default, which is also the max.
+//  safe from overflow, see -s option) during loading of io buffer.
+//
+//      Output file layout (little endian):
+//          char     magic[4]  "FDCT"
+//          uint32_t n2        log2 of frame length
+//          uint32_t hop       hop between frames, samples
+//          uint32_t nframes   number of frames that follow
+//          int32_t  coeffs[nframes][1 << n2]
+//
+//  HOWTOSTART
+//      g++ -O2 -std=c++11 -pthread -I../src/sigproc pcmdct.cpp -o pcmdct
+//      ./pcmdct -n 10 -h 512 -t 4 record.wav record.fdct
+//
+//  PLATFORM
+//      POSIX host (Linux, macOS).
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <thread>
+#include <vector>
+
+#include <PicoDCT.h>
+
+#define FDCT_HDR_SIZE 16                      /* Output file header, bytes. */
+
+namespace
+{
+
+/// @brief KSDATAFORMAT_SUBTYPE_PCM, SubFormat GUID of WAVE_FORMAT_EXTENSIBLE.
+const uint8_t kPcmSubFormat[16] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+                                    0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38,
+                                    0x9B, 0x71 };
+
+/// @brief Input stream description.
+struct PcmDesc
+{
+    const uint8_t *pdata;                        /* ptr to the first sample. */
+    uint64_t nsamples;                       /* samples per channel count. */
+    int bytes;                              /* bytes per sample: 2, 3 or 4. */
+    int nch;                                         /* channels in frame. */
+};
+
+/// @brief Job description shared by all the worker threads.
+struct Job
+{
+    PcmDesc pcm;
+    int ch;                                    /* channel to be processed. */
+    int n2;                                       /* frame length is 2^n2. */
+    int hop;                                    /* hop between frames, smp. */
+    int sbits;                          /* significant bits of DCT input. */
+    int32_t *pout;                        /* ptr to the 1st output frame. */
+};
+
+inline uint32_t Le16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+inline uint32_t Le32(const uint8_t *p)
+{
+    return Le16(p) | (Le16(p + 2) << 16);
+}
+
+inline void PutLe32(uint8_t *p, uint32_t v)
+{
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+/// @brief Loads signed sample & scales it to the given number of bits.
+inline int32_t LoadSample(const uint8_t *p, int bytes, int sbits)
+{
+    int32_t v;
+    switch(bytes)
+    {
+        case 2: v = (int32_t)(int16_t)Le16(p); break;
+        case 3: v = (int32_t)(Le16(p) << 8 | (uint32_t)p[2] << 24) >> 8; break;
+        default: v = (int32_t)Le32(p); break;
+    }
+
+    const int shift = (bytes << 3) - sbits;
+    return shift >= 0 ? v >> shift : v << -shift;
+}
+
+/// @brief Parses RIFF/WAVE header.
+/// @return 0 OK; -1 not a RIFF/WAVE; -2 unsupported format; -3 no data.
+int ParseWav(const uint8_t *p, uint64_t size, PcmDesc *pdesc)
+{
+    if(size < 12 || memcmp(p, "RIFF", 4) || memcmp(p + 8, "WAVE", 4))
+    {
+        return -1;
+    }
+
+    int fmt_ok = 0;
+    uint64_t pos = 12;
+    while(pos + 8 <= size)
+    {
+        const uint8_t *pck = p + pos;
+        uint64_t cksize = Le32(pck + 4);
+
+        if(!memcmp(pck, "fmt ", 4) && cksize >= 16)
+        {
+            if(pos + 8 + 16 > size)
+            {
+                return -2;
+            }
+            const uint32_t tag = Le16(pck + 8);
+            pdesc->nch = Le16(pck + 10);
+            const uint32_t bits = Le16(pck + 22);
+            if((tag != 1 && tag != 0xFFFE) || !pdesc->nch
+               || (bits != 16 && bits != 24 && bits != 32))
+            {
+                return -2;
+            }
+            /* WAVE_FORMAT_EXTENSIBLE: only the PCM SubFormat, not float. */
+            if(tag == 0xFFFE && (cksize < 40 || pos + 8 + 40 > size
+                                 || memcmp(pck + 8 + 24, kPcmSubFormat, 16)))
+            {
+                return -2;
+            }
+            pdesc->bytes = bits >> 3;
+            fmt_ok = 1;
+        }
+        else if(!memcmp(pck, "data", 4))
+        {
+            if(!fmt_ok)
+            {
+                return -2;
+            }
+            /* Streamed recordings often carry a bogus data chunk size. */
+            if(cksize > size - pos - 8)
+            {
+                cksize = size - pos - 8;
+            }
+            pdesc->pdata = pck + 8;
+            pdesc->nsamples = cksize / (pdesc->bytes * pdesc->nch);
+            return 0;
+        }
+
+        pos += 8 + cksize + (cksize & 1);
+    }
+
+    return -3;
+}
+
+/// @brief Transforms frames [first, last) of the job.
+void Worker(const Job *pjob, uint64_t first, uint64_t last)
+{
+    sigproc::PicoDCT pdct(pjob->n2);
+
+    const int len = 1 << pjob->n2;
+    const int bytes = pjob->pcm.bytes;
+    const size_t step = (size_t)bytes * pjob->pcm.nch;
+
+    for(uint64_t fr = first; fr < last; ++fr)
+    {
+        const uint8_t *psrc = pjob->pcm.pdata + (fr * pjob->hop) * step
+                              + (size_t)pjob->ch * bytes;
+        int32_t *pbuf = pdct.SetBuf();
+        for(int i(0); i < len; ++i, psrc += step)
+        {
+            pbuf[i] = LoadSample(psrc, bytes, pjob->sbits);
+        }
+
+        pdct.FwdFDCT(pjob->n2);
+
+        memcpy(pjob->pout + fr * len, pdct.GetBuf(), len * sizeof(int32_t));
+    }
+}
+
+void Usage(void)
+{
+    fprintf(stderr,
+        "Usage: pcmdct [options] <input.wav|input.raw> <output.fdct>\n"
+        "  -n <n2>    frame length 2^n2, [2..12], default 10\n"
+        "  -h <hop>   hop between frames in samples, default 2^n2\n"
+        "  -r <bits>  raw input of 16, 24 or 32-bit samples (no WAV header)\n"
+        "  -c <nch>   channels of raw input, default 1\n"
+        "  -C <ch>    channel to transform, default 0\n"
+        "  -s <bits>  significant bits of DCT input, default & max. 18 - n2\n"
+        "  -t <thr>   worker threads, default: hardware concurrency\n");
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    int n2(10), hop(0), rawbits(0), rawnch(1), ch(0), sbits(0);
+    int nthreads = (int)std::thread::hardware_concurrency();
+
+    int opt;
+    while((opt = getopt(argc, argv, "n:h:r:c:C:s:t:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': n2 = atoi(optarg); break;
+            case 'h': hop = atoi(optarg); break;
+            case 'r': rawbits = atoi(optarg); break;
+            case 'c': rawnch = atoi(optarg); break;
+            case 'C': ch = atoi(optarg); break;
+            case 's': sbits = atoi(optarg); break;
+            case 't': nthreads = atoi(optarg); break;
+            default: Usage(); return 1;
+        }
+    }
+
+    if(!sbits && n2 >= 2 && n2 <= 12)
+    {
+        sbits = sigproc::PicoDCT::InputBits(n2);
+    }
+
+    if(argc - optind != 2 || n2 < 2 || n2 > 12 || hop < 0 || sbits < 1
+       || sbits > sigproc::PicoDCT::InputBits(n2) || rawnch < 1
+       || (rawbits && rawbits != 16 && rawbits != 24 && rawbits != 32))
+    {
+        Usage();
+        return 1;
+    }
+
+    const int len = 1 << n2;
+    if(!hop)
+    {
+        hop = len;
+    }
+    if(nthreads < 1)
+    {
+        nthreads = 1;
+    }
+
+    const int ifd = open(argv[optind], O_RDONLY);
+    struct stat st;
+    if(ifd < 0 || fstat(ifd, &st))
+    {
+        perror(argv[optind]);
+        return 2;
+    }
+
+    const uint64_t isize = (uint64_t)st.st_size;
+    const uint8_t *pin = isize ? (const uint8_t *)mmap(NULL, isize, PROT_READ,
+                                                MAP_PRIVATE, ifd, 0) : NULL;
+    if(pin == MAP_FAILED || !pin)
+    {
+        fprintf(stderr, "%s: unable to map input file\n", argv[optind]);
+        return 2;
+    }
+    madvise((void *)pin, isize, MADV_SEQUENTIAL);
+
+    Job job;
+    if(rawbits)
+    {
+        job.pcm.pdata = pin;
+        job.pcm.bytes = rawbits >> 3;
+        job.pcm.nch = rawnch;
+        job.pcm.nsamples = isize / (job.pcm.bytes * rawnch);
+    }
+    else if(ParseWav(pin, isize, &job.pcm))
+    {
+        fprintf(stderr, "%s: unsupported or broken WAV file (use -r for raw)\n",
+                argv[optind]);
+        return 3;
+    }
+
+    if(ch < 0 || ch >= job.pcm.nch)
+    {
+        fprintf(stderr, "Channel %d is out of range [0..%d]\n", ch, job.pcm.nch - 1);
+        return 1;
+    }
+
+    job.ch = ch;
+    job.n2 = n2;
+    job.hop = hop;
+    job.sbits = sbits;
+
+    const uint64_t nframes = job.pcm.nsamples < (uint64_t)len ? 0
+                             : 1 + (job.pcm.nsamples - len) / hop;
+    if(nframes > 0xFFFFFFFFULL)
+    {
+        fprintf(stderr, "Too many frames, increase the hop\n");
+        return 1;
+    }
+
+    const uint64_t osize = FDCT_HDR_SIZE + nframes * len * sizeof(int32_t);
+
+    const int ofd = open(argv[optind + 1], O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(ofd < 0 || ftruncate(ofd, (off_t)osize))
+    {
+        perror(argv[optind + 1]);
+        return 2;
+    }
+
+    uint8_t *pout = (uint8_t *)mmap(NULL, osize, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, ofd, 0);
+    if(pout == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: unable to map output file\n", argv[optind + 1]);
+        return 2;
+    }
+
+    memcpy(pout, "FDCT", 4);
+    PutLe32(pout + 4, n2);
+    PutLe32(pout + 8, hop);
+    PutLe32(pout + 12, (uint32_t)nframes);
+    job.pout = (int32_t *)(pout + FDCT_HDR_SIZE);
+
+    if((uint64_t)nthreads > nframes)
+    {
+        nthreads = nframes ? (int)nframes : 1;
+    }
+
+    // Tune the plan once here; the workers only read the wisdom store then.
+    {
+        sigproc::PicoDCT tuner(n2);
+    }
+
+    // Contiguous ranges per thread keep both mappings read & written sequentially.
+    std::vector<std::thread> workers;
+    const uint64_t chunk = (nframes + nthreads - 1) / nthreads;
+    for(uint64_t first = 0; first < nframes; first += chunk)
+    {
+        const uint64_t last = first + chunk < nframes ? first + chunk : nframes;
+        workers.push_back(std::thread(Worker, &job, first, last));
+    }
+    for(size_t i(0); i < workers.size(); ++i)
+    {
+        workers[i].join();
+    }
+
+    munmap(pout, osize);
+    munmap((void *)pin, isize);
+    close(ofd);
+    close(ifd);
+
+    fprintf(stderr, "%llu frames of %d bins written\n", (unsigned long long)nframes, len);
+
+    return 0;
+}
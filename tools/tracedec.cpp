@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+//  Roman Piksaykin [piksaykin@gmail.com], R2BDY
+//  https://www.qrz.com/db/r2bdy
+//
+///////////////////////////////////////////////////////////////////////////////
+//
+//
+//  tracedec.cpp - Host decoder of binary trace log dumps.
+//
+//  DESCRIPTION
+//      Reads the binary stream produced by dbg::TraceDrainBinary() (a capture
+//  of Pico's serial port) & prints the records in the same time stamped text
+//  format as dbg::StampPrintf() does. Garbage between records (e.g. regular
+//  text output mixed into the stream) is skipped by means of sync bytes.
+//
+//  HOWTOSTART
+//      g++ -O2 -std=c++11 -I../src/debug tracedec.cpp -o tracedec
+//      ./tracedec capture.bin
+//      cat /dev/ttyACM0 | ./tracedec
+//
+//  PLATFORM
+//      POSIX host (Linux, macOS).
+//
+//  REVISION HISTORY
+//      Rev 0.1   18 Oct 2026   Initial release.
+//
+//  PROJECT PAGE
+//      https://github.com/RPiks/pico-FDCT
+//
+//  LICENCE
+//      MIT License (http://www.opensource.org/licenses/mit-license.php)
+//
+//  Copyright (c) 2024 by Roman Piksaykin
+//
+//  Permission is hereby granted, free of charge,to any person obtaining a copy
+//  of this software and associated documentation files (the Software), to deal
+//  in the Software without restriction,including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY,WHETHER IN AN ACTION OF CONTRACT,TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+///////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdint.h>
+
+#include <TraceLog.h>
+
+namespace
+{
+
+inline uint32_t Le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16)
+           | ((uint32_t)p[3] << 24);
+}
+
+/// @brief Prints a record the same way as dbg::StampPrintf() does.
+void PrintRecord(const uint8_t *p)
+{
+    uint64_t tm_us = ((uint64_t)Le32(p + 4) << 32) | Le32(p);
+    const unsigned id = p[8] | (p[9] << 8);
+    const unsigned seq = p[10] | (p[11] << 8);
+    const long a0 = (int32_t)Le32(p + 12);
+    const long a1 = (int32_t)Le32(p + 16);
+    const long a2 = (int32_t)Le32(p + 20);
+
+    const unsigned long tm_day = (unsigned long)(tm_us / 86400000000ULL);
+    tm_us -= (uint64_t)tm_day * 86400000000ULL;
+
+    const unsigned long tm_hour = (unsigned long)(tm_us / 3600000000ULL);
+    tm_us -= (uint64_t)tm_hour * 3600000000ULL;
+
+    const unsigned long tm_min = (unsigned long)(tm_us / 60000000ULL);
+    tm_us -= (uint64_t)tm_min * 60000000ULL;
+
+    const unsigned long tm_sec = (unsigned long)(tm_us / 1000000ULL);
+    tm_us -= (uint64_t)tm_sec * 1000000ULL;
+
+    printf("%02lud%02lu:%02lu:%02lu.%06llu [%04u] ", tm_day, tm_hour, tm_min,
+           tm_sec, (unsigned long long)tm_us, seq & 0x7FFF);
+    if(id < dbg::TRC_EVENT_COUNT)
+    {
+        printf(dbg::sTraceFormat[id], a0, a1, a2);
+    }
+    else
+    {
+        printf("Unknown event %u: %ld %ld %ld", id, a0, a1, a2);
+    }
+    printf("\n");
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    FILE *pf = argc > 1 ? fopen(argv[1], "rb") : stdin;
+    if(!pf)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    // Scan for sync bytes, then take a record of fixed size.
+    uint8_t rec[sizeof(dbg::TraceRecord)];
+    int prev(-1), c;
+    while((c = fgetc(pf)) != EOF)
+    {
+        if(prev == TRACE_SYNC0 && c == TRACE_SYNC1)
+        {
+            if(fread(rec, sizeof(rec), 1, pf) != 1)
+            {
+                break;
+            }
+            PrintRecord(rec);
+            prev = -1;
+            continue;
+        }
+        prev = c;
+    }
+
+    if(pf != stdin)
+    {
+        fclose(pf);
+    }
+
+    return 0;
+}